@@ -0,0 +1,221 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace Mantid {
+namespace API {
+/**
+  A number for forward mode automatic differentiation. It holds a value
+  together with its derivatives with respect to N independent variables,
+  which are propagated exactly through arithmetic and the elementary
+  functions below.
+
+  A fitting function can write its formula once as a template over the number
+  type, evaluate it with double in function1D and with DualNumber in
+  functionDeriv1D, where the parameters are created with variable():
+
+  @code
+  using Dual = API::DualNumber<2>;
+  const auto height = Dual::variable(getParameter("Height"), 0);
+  const auto lifetime = Dual::variable(getParameter("Lifetime"), 1);
+  for (size_t i = 0; i < nData; ++i) {
+    const auto y = expDecay(height, lifetime, xValues[i]);
+    out->set(i, 0, y.derivative(0));
+    out->set(i, 1, y.derivative(1));
+  }
+  @endcode
+
+  The template should bring std::exp etc. into scope with using declarations
+  so that both number types find their overloads.
+*/
+template <std::size_t N> class DualNumber {
+public:
+  /// Construct a constant, i.e. a number with zero derivatives
+  constexpr DualNumber(double value = 0.0)
+      : m_value(value), m_derivatives{} {}
+
+  /// Create the independent variable with the given index
+  static DualNumber variable(double value, std::size_t index) {
+    DualNumber result(value);
+    result.m_derivatives[index] = 1.0;
+    return result;
+  }
+
+  /// The value of the number
+  constexpr double value() const { return m_value; }
+  /// The derivative with respect to the variable with the given index
+  constexpr double derivative(std::size_t index) const {
+    return m_derivatives[index];
+  }
+
+  DualNumber &operator+=(const DualNumber &other) {
+    m_value += other.m_value;
+    for (std::size_t i = 0; i < N; ++i)
+      m_derivatives[i] += other.m_derivatives[i];
+    return *this;
+  }
+
+  DualNumber &operator-=(const DualNumber &other) {
+    m_value -= other.m_value;
+    for (std::size_t i = 0; i < N; ++i)
+      m_derivatives[i] -= other.m_derivatives[i];
+    return *this;
+  }
+
+  DualNumber &operator*=(const DualNumber &other) {
+    for (std::size_t i = 0; i < N; ++i)
+      m_derivatives[i] = m_derivatives[i] * other.m_value +
+                         m_value * other.m_derivatives[i];
+    m_value *= other.m_value;
+    return *this;
+  }
+
+  DualNumber &operator/=(const DualNumber &other) {
+    const double inverse = 1.0 / other.m_value;
+    m_value *= inverse;
+    for (std::size_t i = 0; i < N; ++i)
+      m_derivatives[i] =
+          (m_derivatives[i] - m_value * other.m_derivatives[i]) * inverse;
+    return *this;
+  }
+
+  DualNumber operator-() const {
+    DualNumber result(-m_value);
+    for (std::size_t i = 0; i < N; ++i)
+      result.m_derivatives[i] = -m_derivatives[i];
+    return result;
+  }
+
+  /// Apply the chain rule for a function with the given value and first
+  /// derivative at this number. Variables this number does not depend on
+  /// keep a zero derivative even where the function derivative is infinite.
+  DualNumber chain(double value, double derivative) const {
+    DualNumber result(value);
+    for (std::size_t i = 0; i < N; ++i)
+      result.m_derivatives[i] =
+          m_derivatives[i] == 0.0 ? 0.0 : derivative * m_derivatives[i];
+    return result;
+  }
+
+private:
+  double m_value;
+  std::array<double, N> m_derivatives;
+};
+
+template <std::size_t N>
+DualNumber<N> operator+(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs += rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator+(DualNumber<N> lhs, double rhs) {
+  return lhs += DualNumber<N>(rhs);
+}
+
+template <std::size_t N>
+DualNumber<N> operator+(double lhs, const DualNumber<N> &rhs) {
+  return rhs + lhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator-(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs -= rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator-(DualNumber<N> lhs, double rhs) {
+  return lhs -= DualNumber<N>(rhs);
+}
+
+template <std::size_t N>
+DualNumber<N> operator-(double lhs, const DualNumber<N> &rhs) {
+  return DualNumber<N>(lhs) -= rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator*(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs *= rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator*(const DualNumber<N> &lhs, double rhs) {
+  return lhs.chain(lhs.value() * rhs, rhs);
+}
+
+template <std::size_t N>
+DualNumber<N> operator*(double lhs, const DualNumber<N> &rhs) {
+  return rhs * lhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator/(DualNumber<N> lhs, const DualNumber<N> &rhs) {
+  return lhs /= rhs;
+}
+
+template <std::size_t N>
+DualNumber<N> operator/(const DualNumber<N> &lhs, double rhs) {
+  return lhs * (1.0 / rhs);
+}
+
+template <std::size_t N>
+DualNumber<N> operator/(double lhs, const DualNumber<N> &rhs) {
+  return DualNumber<N>(lhs) /= rhs;
+}
+
+template <std::size_t N> DualNumber<N> exp(const DualNumber<N> &x) {
+  const double value = std::exp(x.value());
+  return x.chain(value, value);
+}
+
+template <std::size_t N> DualNumber<N> log(const DualNumber<N> &x) {
+  return x.chain(std::log(x.value()), 1.0 / x.value());
+}
+
+template <std::size_t N> DualNumber<N> sqrt(const DualNumber<N> &x) {
+  const double value = std::sqrt(x.value());
+  return x.chain(value, 0.5 / value);
+}
+
+template <std::size_t N> DualNumber<N> sin(const DualNumber<N> &x) {
+  return x.chain(std::sin(x.value()), std::cos(x.value()));
+}
+
+template <std::size_t N> DualNumber<N> cos(const DualNumber<N> &x) {
+  return x.chain(std::cos(x.value()), -std::sin(x.value()));
+}
+
+template <std::size_t N>
+DualNumber<N> pow(const DualNumber<N> &base, double exponent) {
+  if (exponent == 0.0)
+    return DualNumber<N>(1.0);
+  const double value = std::pow(base.value(), exponent);
+  return base.chain(value,
+                    exponent * std::pow(base.value(), exponent - 1.0));
+}
+
+template <std::size_t N>
+DualNumber<N> pow(const DualNumber<N> &base, const DualNumber<N> &exponent) {
+  const double value = std::pow(base.value(), exponent.value());
+  DualNumber<N> result = pow(base, exponent.value());
+  // d/dy x^y = x^y ln(x), which tends to zero as x tends to zero
+  if (base.value() > 0.0)
+    result += exponent.chain(0.0, value * std::log(base.value()));
+  return result;
+}
+
+template <std::size_t N>
+DualNumber<N> pow(double base, const DualNumber<N> &exponent) {
+  const double value = std::pow(base, exponent.value());
+  return exponent.chain(value, base > 0.0 ? value * std::log(base) : 0.0);
+}
+
+} // namespace API
+} // namespace Mantid
@@ -59,7 +59,7 @@ public:
   std::map<specnum_t, Mantid::Kernel::V3D> neighbours(specnum_t spectrum) const;
 
 protected:
-  std::vector<size_t> getSpectraDetectors();
+  std::vector<size_t> getSpectraDetectors() const;
 
 private:
   /// A reference to the SpectrumInfo
@@ -80,6 +80,8 @@ private:
   /// Construct the graph based on the given number of neighbours and the
   /// current instument and spectra-detector mapping
   void build(const int noNeighbours);
+  /// Find the number of neighbours required to reach beyond a radius
+  int neighboursBeyondRadius(const double radius) const;
   /// Query the graph for the default number of nearest neighbours to specified
   /// detector
   std::map<specnum_t, Mantid::Kernel::V3D>
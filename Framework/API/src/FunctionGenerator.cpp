@@ -36,8 +36,12 @@ void FunctionGenerator::setSource(IFunction_sptr source) const {
 void FunctionGenerator::setParameter(size_t i, const double &value,
                                      bool explicitlySet) {
   if (i < m_nOwnParams) {
+    // The target is regenerated only if a source parameter actually changes,
+    // e.g. not when a fit resets the parameters to their current values.
+    if (value != m_source->getParameter(i)) {
+      m_dirty = true;
+    }
     m_source->setParameter(i, value, explicitlySet);
-    m_dirty = true;
   } else {
     checkTargetFunction();
     m_target->setParameter(i - m_nOwnParams, value, explicitlySet);
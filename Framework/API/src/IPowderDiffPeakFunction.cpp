@@ -246,14 +246,35 @@ std::complex<double> E1(std::complex<double> z) {
     const double el = 0.5772156649015328;
     exp_e1 = -el - log(z) + (z * exp_e1);
   } else {
-    // Rest of the region
-    std::complex<double> ct0(0.0, 0.0);
-    for (int k = 120; k > 0; --k) {
-      std::complex<double> dk(double(k), 0.0);
-      ct0 = dk / (10.0 + dk / (z + ct0));
-    } // ENDFOR k
+    // Rest of the region: the continued fraction
+    //   z + 1/(10 + 1/(z + 2/(10 + 2/(z + ...))))
+    // is evaluated from the top with the modified Lentz method. It stops once
+    // a further term changes the value by less than the relative tolerance,
+    // which takes around ten terms here, instead of always summing 120 terms
+    // from the bottom.
+    const double tiny = 1.0E-300;
+    const double tolerance = 1.0E-15;
+    std::complex<double> f = z;
+    std::complex<double> c = f;
+    std::complex<double> d(0.0, 0.0);
+    for (int j = 1; j <= 240; ++j) {
+      const auto a = static_cast<double>((j + 1) / 2);
+      const std::complex<double> b =
+          j % 2 == 1 ? std::complex<double>(10.0, 0.0) : z;
+      d = b + a * d;
+      if (abs(d) == 0.0)
+        d = tiny;
+      d = 1.0 / d;
+      c = b + a / c;
+      if (abs(c) == 0.0)
+        c = tiny;
+      const std::complex<double> delta = c * d;
+      f *= delta;
+      if (abs(delta - 1.0) < tolerance)
+        break;
+    } // ENDFOR j
 
-    exp_e1 = 1.0 / (z + ct0);
+    exp_e1 = 1.0 / f;
     exp_e1 = exp_e1 * exp(-z);
     if (rz < 0.0 && fabs(imag(z)) < 1.0E-10) {
       std::complex<double> u(0.0, 1.0);
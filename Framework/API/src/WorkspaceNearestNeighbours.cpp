@@ -14,6 +14,10 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Timer.h"
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
 namespace Mantid {
 using namespace Geometry;
 namespace API {
@@ -81,19 +85,11 @@ WorkspaceNearestNeighbours::neighboursInRadius(const specnum_t spectrum,
     }
     result = defaultNeighbours(spectrum);
   } else if (radius > m_cutoff && m_radius != radius) {
-    // We might have to see how efficient this ends up being.
-    int neighbours = m_noNeighbours + 1;
-    while (true) {
-      try {
-        const_cast<WorkspaceNearestNeighbours *>(this)->build(neighbours);
-      } catch (std::invalid_argument &) {
-        break;
-      }
-      if (radius < m_cutoff)
-        break;
-      else
-        neighbours += 1;
-    }
+    // Rebuild once with the smallest number of neighbours that reaches beyond
+    // the radius
+    const int neighbours = neighboursBeyondRadius(radius);
+    if (neighbours != m_noNeighbours)
+      const_cast<WorkspaceNearestNeighbours *>(this)->build(neighbours);
   }
   m_radius = radius;
 
@@ -197,6 +193,76 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   m_edgeLength = get(boost::edge_name, m_graph);
 }
 
+/**
+ * Find the smallest number of neighbours, larger than the current one, for
+ * which the graph would hold a neighbour further away than the given radius.
+ * The k-d tree is searched for a growing number of neighbours, doubling each
+ * time, so that only a few searches are required rather than a full rebuild
+ * of the graph for every additional neighbour.
+ * @param radius :: The distance the neighbours must reach beyond
+ * @return The number of neighbours, capped at the number of spectra - 1
+ */
+int WorkspaceNearestNeighbours::neighboursBeyondRadius(
+    const double radius) const {
+  const auto indices = getSpectraDetectors();
+  const auto nspectra = static_cast<int>(indices.size());
+  const int maxNeighbours = nspectra - 1;
+  if (m_noNeighbours >= maxNeighbours)
+    return m_noNeighbours;
+
+  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
+  int pointNo = 0;
+  for (const auto i : indices) {
+    const V3D pos = m_spectrumInfo.position(i) / m_scale;
+    dataPoints[pointNo][0] = pos.X();
+    dataPoints[pointNo][1] = pos.Y();
+    dataPoints[pointNo][2] = pos.Z();
+    ++pointNo;
+  }
+  auto annTree = std::make_unique<ANNkd_tree>(dataPoints, nspectra, 3);
+
+  int result = maxNeighbours;
+  int nSearch = std::min(2 * (m_noNeighbours + 1), maxNeighbours);
+  std::vector<ANNidx> nnIndexList;
+  std::vector<ANNdist> nnDistList;
+  // cutoffs[k - 1] is the largest separation found using k neighbours
+  std::vector<double> cutoffs;
+  while (true) {
+    nnIndexList.resize(nSearch);
+    nnDistList.resize(nSearch);
+    cutoffs.assign(nSearch, std::numeric_limits<double>::lowest());
+    for (pointNo = 0; pointNo < nspectra; ++pointNo) {
+      ANNpoint scaledPos = dataPoints[pointNo];
+      annTree->annkSearch(scaledPos, nSearch, nnIndexList.data(),
+                          nnDistList.data(), 0.0);
+      const V3D realPos =
+          V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
+      double separation = std::numeric_limits<double>::lowest();
+      for (int i = 0; i < nSearch; ++i) {
+        const ANNpoint neighbour = dataPoints[nnIndexList[i]];
+        const V3D distance =
+            V3D(neighbour[0], neighbour[1], neighbour[2]) * m_scale - realPos;
+        separation = std::max(separation, distance.norm());
+        cutoffs[i] = std::max(cutoffs[i], separation);
+      }
+    }
+    const auto beyond = std::find_if(
+        cutoffs.cbegin() + m_noNeighbours, cutoffs.cend(),
+        [radius](const double cutoff) { return cutoff > radius; });
+    if (beyond != cutoffs.cend()) {
+      result = static_cast<int>(std::distance(cutoffs.cbegin(), beyond)) + 1;
+      break;
+    }
+    if (nSearch == maxNeighbours)
+      break;
+    nSearch = std::min(2 * nSearch, maxNeighbours);
+  }
+  annTree.reset();
+  annDeallocPts(dataPoints);
+  annClose();
+  return result;
+}
+
 /**
  * Returns a map of the spectrum numbers to the nearest detectors and their
  * distance from the detector specified in the argument.
@@ -228,7 +294,7 @@ WorkspaceNearestNeighbours::defaultNeighbours(const specnum_t spectrum) const {
 }
 
 /// Returns the list of valid spectrum indices
-std::vector<size_t> WorkspaceNearestNeighbours::getSpectraDetectors() {
+std::vector<size_t> WorkspaceNearestNeighbours::getSpectraDetectors() const {
   std::vector<size_t> indices;
   const auto nSpec = m_spectrumNumbers.size();
   indices.reserve(nSpec);
@@ -15,6 +15,7 @@
 #include "MantidTestHelpers/InstrumentCreationHelper.h"
 
 #include <algorithm>
+#include <cmath>
 
 using namespace Mantid;
 using namespace Mantid::Kernel;
@@ -144,6 +145,30 @@ public:
     TS_ASSERT_THROWS(detectorInfo.twoTheta(4), const std::logic_error &);
   }
 
+  void test_l2s() {
+    const auto &detectorInfo = m_workspace.detectorInfo();
+    const auto l2s = detectorInfo.l2s(0, detectorInfo.size());
+    TS_ASSERT_EQUALS(l2s.size(), detectorInfo.size());
+    for (size_t i = 0; i < detectorInfo.size(); ++i)
+      TS_ASSERT_EQUALS(l2s[i], detectorInfo.l2(i));
+    const auto part = detectorInfo.l2s(1, 3);
+    TS_ASSERT_EQUALS(part.size(), 2);
+    TS_ASSERT_EQUALS(part[0], detectorInfo.l2(1));
+    TS_ASSERT_THROWS(detectorInfo.l2s(0, detectorInfo.size() + 1),
+                     const std::out_of_range &);
+  }
+
+  void test_twoThetas() {
+    const auto &detectorInfo = m_workspace.detectorInfo();
+    const auto twoThetas = detectorInfo.twoThetas(0, detectorInfo.size());
+    TS_ASSERT_EQUALS(twoThetas.size(), detectorInfo.size());
+    for (size_t i = 0; i < 3; ++i)
+      TS_ASSERT_EQUALS(twoThetas[i], detectorInfo.twoTheta(i));
+    // Monitors
+    TS_ASSERT(std::isnan(twoThetas[3]));
+    TS_ASSERT(std::isnan(twoThetas[4]));
+  }
+
   // Legacy test via the workspace method detectorTwoTheta(), which might be
   // removed at some point.
   void test_twoThetaLegacy() {
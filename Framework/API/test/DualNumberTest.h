@@ -0,0 +1,98 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DualNumber.h"
+
+#include <cxxtest/TestSuite.h>
+
+using Mantid::API::DualNumber;
+using Dual = DualNumber<2>;
+
+class DualNumberTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DualNumberTest *createSuite() { return new DualNumberTest(); }
+  static void destroySuite(DualNumberTest *suite) { delete suite; }
+
+  void test_constant_has_zero_derivatives() {
+    const Dual c(3.0);
+    TS_ASSERT_EQUALS(c.value(), 3.0);
+    TS_ASSERT_EQUALS(c.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(c.derivative(1), 0.0);
+  }
+
+  void test_variable() {
+    const auto y = Dual::variable(2.0, 1);
+    TS_ASSERT_EQUALS(y.value(), 2.0);
+    TS_ASSERT_EQUALS(y.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(y.derivative(1), 1.0);
+  }
+
+  void test_arithmetic() {
+    const auto x = Dual::variable(3.0, 0);
+    const auto y = Dual::variable(2.0, 1);
+
+    const auto sum = x + 2.0 * y - 1.0;
+    TS_ASSERT_DELTA(sum.value(), 6.0, 1e-12);
+    TS_ASSERT_DELTA(sum.derivative(0), 1.0, 1e-12);
+    TS_ASSERT_DELTA(sum.derivative(1), 2.0, 1e-12);
+
+    const auto product = x * y;
+    TS_ASSERT_DELTA(product.value(), 6.0, 1e-12);
+    TS_ASSERT_DELTA(product.derivative(0), 2.0, 1e-12);
+    TS_ASSERT_DELTA(product.derivative(1), 3.0, 1e-12);
+
+    const auto quotient = x / y;
+    TS_ASSERT_DELTA(quotient.value(), 1.5, 1e-12);
+    TS_ASSERT_DELTA(quotient.derivative(0), 0.5, 1e-12);
+    TS_ASSERT_DELTA(quotient.derivative(1), -0.75, 1e-12);
+
+    const auto inverse = 1.0 / x;
+    TS_ASSERT_DELTA(inverse.value(), 1.0 / 3.0, 1e-12);
+    TS_ASSERT_DELTA(inverse.derivative(0), -1.0 / 9.0, 1e-12);
+  }
+
+  void test_elementary_functions() {
+    const auto x = Dual::variable(0.5, 0);
+
+    const auto e = exp(x);
+    TS_ASSERT_DELTA(e.value(), std::exp(0.5), 1e-12);
+    TS_ASSERT_DELTA(e.derivative(0), std::exp(0.5), 1e-12);
+
+    const auto l = log(x);
+    TS_ASSERT_DELTA(l.value(), std::log(0.5), 1e-12);
+    TS_ASSERT_DELTA(l.derivative(0), 2.0, 1e-12);
+
+    const auto s = sqrt(x);
+    TS_ASSERT_DELTA(s.derivative(0), 0.5 / std::sqrt(0.5), 1e-12);
+
+    TS_ASSERT_DELTA(sin(x).derivative(0), std::cos(0.5), 1e-12);
+    TS_ASSERT_DELTA(cos(x).derivative(0), -std::sin(0.5), 1e-12);
+    TS_ASSERT_DELTA(pow(x, 3.0).derivative(0), 0.75, 1e-12);
+  }
+
+  void test_pow_with_variable_exponent() {
+    const auto x = Dual::variable(2.0, 0);
+    const auto y = Dual::variable(3.0, 1);
+    const auto p = pow(x, y);
+    TS_ASSERT_DELTA(p.value(), 8.0, 1e-12);
+    TS_ASSERT_DELTA(p.derivative(0), 12.0, 1e-12);
+    TS_ASSERT_DELTA(p.derivative(1), 8.0 * std::log(2.0), 1e-12);
+  }
+
+  void test_pow_of_zero_base_has_finite_derivatives() {
+    // The base depends on neither variable, as for x * parameter at x = 0
+    const auto base = Dual::variable(0.7, 0) * 0.0;
+    const auto exponent = Dual::variable(0.5, 1);
+    const auto p = pow(base, exponent);
+    TS_ASSERT_EQUALS(p.value(), 0.0);
+    TS_ASSERT_EQUALS(p.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(p.derivative(1), 0.0);
+  }
+};
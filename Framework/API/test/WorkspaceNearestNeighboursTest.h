@@ -138,6 +138,25 @@ public:
     TS_ASSERT_EQUALS(distances.size(), 17);
   }
 
+  void testNeighboursInRadiusMatchesFullSearch() {
+    const auto ws = makeWorkspace(1, 18);
+    ws->setInstrument(
+        ComponentCreationHelper::createTestInstrumentCylindrical(2));
+    const auto &spectrumInfo = ws->spectrumInfo();
+    const auto spectrumNumbers = getSpectrumNumbers(*ws);
+    WorkspaceNearestNeighbours nn(8, spectrumInfo, spectrumNumbers);
+    WorkspaceNearestNeighbours nnAll(17, spectrumInfo, spectrumNumbers);
+
+    const auto expected = nnAll.neighbours(14);
+    const auto distances = nn.neighboursInRadius(14, 6.0);
+    TS_ASSERT_EQUALS(distances.size(), expected.size());
+    for (const auto &neighbour : distances) {
+      TS_ASSERT_EQUALS(expected.count(neighbour.first), 1);
+    }
+    // The graph now holds all neighbours
+    TS_ASSERT_EQUALS(nn.neighbours(14).size(), 17);
+  }
+
   void testNeighbourFindingWithNeighbourNumberSpecified() {
     doTestWithNeighbourNumbers(1, 1);
     doTestWithNeighbourNumbers(2, 2);
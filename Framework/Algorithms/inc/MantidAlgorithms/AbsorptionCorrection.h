@@ -122,7 +122,7 @@ private:
   void calculateDistances(const Geometry::IDetector &detector,
                           std::vector<double> &L2s) const;
   inline double doIntegration(const double linearCoefAbs,
-                              const std::vector<double> &L2s,
+                              const std::vector<double> &pathLengths,
                               const size_t startIndex,
                               const size_t endIndex) const;
   inline double doIntegration(const double linearCoefAbsL1,
@@ -122,7 +122,9 @@ private:
   /// fit peaks in a same spectrum
   void fitSpectrumPeaks(
       size_t wi, const std::vector<double> &expected_peak_centers,
-      const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result);
+      const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result,
+      const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>
+          &neighbour_result = nullptr);
 
   /// fit background
   bool fitBackground(const size_t &ws_index,
@@ -305,6 +307,8 @@ private:
   /// from 'observation' (3) calculated from instrument resolution
   EstimatePeakWidth m_peakWidthEstimateApproach;
   bool m_constrainPeaksPosition;
+  /// flag to start fitting from the result of the previous spectrum
+  bool m_startFromNeighbourFit;
 
   /// peak windows
   std::vector<std::vector<double>> m_peakWindowVector;
@@ -53,6 +53,12 @@ public:
                  MCInteractionStatistics &stats);
 
 private:
+  void calculatePerWavelength(Kernel::PseudoRandomNumberGenerator &rng,
+                              const Kernel::V3D &finalPos,
+                              const std::vector<double> &lambdas,
+                              const double lambdaFixed,
+                              std::vector<double> &attenuationFactors,
+                              MCInteractionStatistics &stats);
   const IBeamProfile &m_beamProfile;
   const MCInteractionVolume m_scatterVol;
   const size_t m_nevents;
@@ -11,6 +11,7 @@
 #include "MantidGeometry/Objects/BoundingBox.h"
 #include "MantidKernel/Logger.h"
 #include <boost/optional.hpp>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -66,6 +67,9 @@ public:
   double calculateAbsorption(const Geometry::Track &beforeScatter,
                              const Geometry::Track &afterScatter,
                              double lambdaBefore, double lambdaAfter) const;
+  void addAttenuationExponents(const Geometry::Track &path,
+                               const std::vector<double> &lambdas,
+                               std::vector<double> &exponents) const;
   ComponentScatterPoint
   generatePoint(Kernel::PseudoRandomNumberGenerator &rng) const;
 
@@ -28,6 +28,9 @@
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 
+#include <algorithm>
+#include <functional>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -213,6 +216,18 @@ void AbsorptionCorrection::exec() {
   }
 
   const auto &spectrumInfo = m_inputWS->spectrumInfo();
+  // Per-thread storage for the distances through each element. In the elastic
+  // case only the total path length L1 + L2 is needed, so it is formed once
+  // per detector rather than for every wavelength point.
+  const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  std::vector<std::vector<double>> threadL2s(
+      nThreads, std::vector<double>(m_numVolumeElements));
+  std::vector<std::vector<double>> threadPathLengths(nThreads);
+  if (m_emode == DeltaEMode::Elastic) {
+    threadPathLengths.assign(nThreads,
+                             std::vector<double>(m_numVolumeElements));
+  }
+
   Progress prog(this, 0.0, 1.0, numHists);
   // Loop over the spectra
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWS, *correctionFactors))
@@ -228,8 +243,14 @@ void AbsorptionCorrection::exec() {
     }
     const auto &det = spectrumInfo.detector(i);
 
-    std::vector<double> L2s(m_numVolumeElements);
+    const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+    auto &L2s = threadL2s[thread];
     calculateDistances(det, L2s);
+    auto &pathLengths = threadPathLengths[thread];
+    if (m_emode == DeltaEMode::Elastic) {
+      std::transform(L2s.cbegin(), L2s.cend(), m_L1s.cbegin(),
+                     pathLengths.begin(), std::plus<double>());
+    }
 
     // If an indirect instrument, see if there's an efixed in the parameter map
     double lambdaFixed = m_lambdaFixed;
@@ -257,7 +278,8 @@ void AbsorptionCorrection::exec() {
     // Loop through the bins in the current spectrum every m_xStep
     for (int64_t j = 0; j < specSize; j = j + m_xStep) {
       if (m_emode == DeltaEMode::Elastic) {
-        Y[j] = this->doIntegration(-linearCoefAbs[j], L2s, 0, L2s.size());
+        Y[j] = this->doIntegration(-linearCoefAbs[j], pathLengths, 0,
+                                   pathLengths.size());
       } else if (m_emode == DeltaEMode::Direct) {
         Y[j] = this->doIntegration(linearCoefAbsFixed, -linearCoefAbs[j], L2s,
                                    0, L2s.size());
@@ -476,23 +498,22 @@ void AbsorptionCorrection::calculateDistances(const IDetector &detector,
 // https://en.wikipedia.org/wiki/Pairwise_summation
 
 /// Carries out the numerical integration over the sample for elastic
-/// instruments
-double AbsorptionCorrection::doIntegration(const double linearCoefAbs,
-                                           const std::vector<double> &L2s,
-                                           const size_t startIndex,
-                                           const size_t endIndex) const {
+/// instruments. pathLengths holds L1 + L2 for each element.
+double AbsorptionCorrection::doIntegration(
+    const double linearCoefAbs, const std::vector<double> &pathLengths,
+    const size_t startIndex, const size_t endIndex) const {
   if (endIndex - startIndex > MAX_INTEGRATION_LENGTH) {
     size_t middle = findMiddle(startIndex, endIndex);
 
-    return doIntegration(linearCoefAbs, L2s, startIndex, middle) +
-           doIntegration(linearCoefAbs, L2s, middle, endIndex);
+    return doIntegration(linearCoefAbs, pathLengths, startIndex, middle) +
+           doIntegration(linearCoefAbs, pathLengths, middle, endIndex);
   } else {
     double integral = 0.0;
+    const double linearCoef = linearCoefAbs + m_linearCoefTotScatt;
 
     // Iterate over all the elements, summing up the integral
     for (size_t i = startIndex; i < endIndex; ++i) {
-      const double exponent =
-          (linearCoefAbs + m_linearCoefTotScatt) * (m_L1s[i] + L2s[i]);
+      const double exponent = linearCoef * pathLengths[i];
       integral += (EXPONENTIAL(exponent) * (m_elementVolumes[i]));
     }
 
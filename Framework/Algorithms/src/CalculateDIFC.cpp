@@ -21,6 +21,8 @@ void calculateFromOffset(API::Progress &progress,
   const auto &detectorIDs = detectorInfo.detectorIDs();
   const bool haveOffset = (offsetsWS != nullptr);
   const double l1 = detectorInfo.l1();
+  const auto l2s = detectorInfo.l2s(0, detectorInfo.size());
+  const auto twoThetas = detectorInfo.twoThetas(0, detectorInfo.size());
 
   for (size_t i = 0; i < detectorInfo.size(); ++i) {
     if ((!detectorInfo.isMasked(i)) && (!detectorInfo.isMonitor(i))) {
@@ -29,9 +31,8 @@ void calculateFromOffset(API::Progress &progress,
           (haveOffset) ? offsetsWS->getValue(detectorIDs[i], 0.) : 0.;
 
       // tofToDSpacingFactor gives 1/DIFC
-      double difc =
-          1. / Geometry::Conversion::tofToDSpacingFactor(
-                   l1, detectorInfo.l2(i), detectorInfo.twoTheta(i), offset);
+      double difc = 1. / Geometry::Conversion::tofToDSpacingFactor(
+                             l1, l2s[i], twoThetas[i], offset);
       outputWs.setValue(detectorIDs[i], difc);
     }
 
@@ -33,6 +33,7 @@
 
 #include "boost/algorithm/string.hpp"
 #include "boost/algorithm/string/trim.hpp"
+#include <algorithm>
 #include <limits>
 #include <utility>
 
@@ -72,6 +73,7 @@ const std::string HIGH_BACKGROUND("HighBackground");
 const std::string POSITION_TOL("PositionTolerance");
 const std::string PEAK_MIN_HEIGHT("MinimumPeakHeight");
 const std::string CONSTRAIN_PEAK_POS("ConstrainPeakPositions");
+const std::string START_FROM_NEIGHBOUR("StartFromNeighbourFit");
 const std::string OUTPUT_WKSP_MODEL("FittedPeaksWorkspace");
 const std::string OUTPUT_WKSP_PARAMS("OutputPeakParametersWorkspace");
 const std::string OUTPUT_WKSP_PARAM_ERRS("OutputParameterFitErrorsWorkspace");
@@ -357,9 +359,16 @@ void FitPeaks::init() {
   declareProperty(PropertyNames::MAX_FIT_ITER, 50, min_max_iter,
                   "Maximum number of function fitting iterations.");
 
+  declareProperty(PropertyNames::START_FROM_NEIGHBOUR, false,
+                  "If true, each peak starts from the parameters fitted to the "
+                  "same peak in the previous spectrum, which usually belongs "
+                  "to a neighbouring detector. The spectra are then fitted in "
+                  "blocks of consecutive workspace indices.");
+
   const std::string optimizergrp("Optimization Setup");
   setPropertyGroup(PropertyNames::MINIMIZER, optimizergrp);
   setPropertyGroup(PropertyNames::COST_FUNC, optimizergrp);
+  setPropertyGroup(PropertyNames::START_FROM_NEIGHBOUR, optimizergrp);
 
   // other helping information
   declareProperty(
@@ -562,6 +571,7 @@ void FitPeaks::processInputs() {
   m_fitPeaksFromRight = getProperty(PropertyNames::FIT_FROM_RIGHT);
   m_constrainPeaksPosition = getProperty(PropertyNames::CONSTRAIN_PEAK_POS);
   m_fitIterations = getProperty(PropertyNames::MAX_FIT_ITER);
+  m_startFromNeighbourFit = getProperty(PropertyNames::START_FROM_NEIGHBOUR);
 
   // Peak centers, tolerance and fitting range
   processInputPeakCenters();
@@ -938,33 +948,46 @@ FitPeaks::fitPeaks() {
   std::vector<std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>>
       fit_result_vector(num_fit_result);
 
+  // When starting from the fits of neighbouring spectra, the spectra are
+  // fitted in blocks of consecutive workspace indices. The result then does not
+  // depend on the number of threads.
+  const size_t block_size = m_startFromNeighbourFit ? 16 : 1;
+  const auto num_blocks =
+      static_cast<int>((num_fit_result + block_size - 1) / block_size);
+
   // cppcheck-suppress syntaxError
   PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-  for (auto wi = static_cast<int>(m_startWorkspaceIndex);
-       wi <= static_cast<int>(m_stopWorkspaceIndex); ++wi) {
+  for (int iblock = 0; iblock < num_blocks; ++iblock) {
 
     PARALLEL_START_INTERUPT_REGION
 
-    // peaks to fit
-    std::vector<double> expected_peak_centers =
-        getExpectedPeakPositions(static_cast<size_t>(wi));
-
-    // initialize output for this
-    size_t numfuncparams =
-        m_peakFunction->nParams() + m_bkgdFunction->nParams();
-    std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result =
-        std::make_shared<FitPeaksAlgorithm::PeakFitResult>(m_numPeaksToFit,
-                                                           numfuncparams);
-
-    fitSpectrumPeaks(static_cast<size_t>(wi), expected_peak_centers,
-                     fit_result);
-
-    PARALLEL_CRITICAL(FindPeaks_WriteOutput) {
-      writeFitResult(static_cast<size_t>(wi), expected_peak_centers,
-                     fit_result);
-      fit_result_vector[wi - m_startWorkspaceIndex] = fit_result;
+    const size_t block_start =
+        m_startWorkspaceIndex + static_cast<size_t>(iblock) * block_size;
+    const size_t block_stop =
+        std::min(block_start + block_size, m_stopWorkspaceIndex + 1);
+    std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> neighbour_result;
+    for (size_t wi = block_start; wi < block_stop; ++wi) {
+      // peaks to fit
+      std::vector<double> expected_peak_centers = getExpectedPeakPositions(wi);
+
+      // initialize output for this
+      size_t numfuncparams =
+          m_peakFunction->nParams() + m_bkgdFunction->nParams();
+      std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> fit_result =
+          std::make_shared<FitPeaksAlgorithm::PeakFitResult>(m_numPeaksToFit,
+                                                             numfuncparams);
+
+      fitSpectrumPeaks(wi, expected_peak_centers, fit_result,
+                       neighbour_result);
+
+      PARALLEL_CRITICAL(FindPeaks_WriteOutput) {
+        writeFitResult(wi, expected_peak_centers, fit_result);
+        fit_result_vector[wi - m_startWorkspaceIndex] = fit_result;
+      }
+      if (m_startFromNeighbourFit)
+        neighbour_result = fit_result;
+      prog.report();
     }
-    prog.report();
 
     PARALLEL_END_INTERUPT_REGION
   }
@@ -1022,10 +1045,17 @@ double numberCounts(const Histogram &histogram, const double xmin,
 
 //----------------------------------------------------------------------------------------------
 /** Fit peaks across one single spectrum
+ * @param wi :: workspace index of the spectrum
+ * @param expected_peak_centers :: expected positions of the peaks to fit
+ * @param fit_result :: (output) fitting result of the spectrum
+ * @param neighbour_result :: fitting result of a neighbouring spectrum to
+ * start from. It is ignored for peaks that failed to fit there or if null.
  */
 void FitPeaks::fitSpectrumPeaks(
     size_t wi, const std::vector<double> &expected_peak_centers,
-    const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result) {
+    const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result,
+    const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>
+        &neighbour_result) {
   if (numberCounts(m_inputMatrixWS->histogram(wi)) <= m_minPeakHeight) {
     for (size_t i = 0; i < fit_result->getNumberPeaks(); ++i)
       fit_result->setBadRecord(i, -1.);
@@ -1086,8 +1116,19 @@ void FitPeaks::fitSpectrumPeaks(
       std::pair<double, double> peak_window_i =
           getPeakFitWindow(wi, peak_index);
 
-      bool observe_peak_params =
-          decideToEstimatePeakParams(!foundAnyPeak, peakfunction);
+      bool observe_peak_params;
+      if (neighbour_result &&
+          neighbour_result->getCost(peak_index) < DBL_MAX - 1.) {
+        // start from the same peak fitted in the neighbouring spectrum
+        for (size_t i = 0; i < peakfunction->nParams(); ++i)
+          peakfunction->setParameter(
+              i, neighbour_result->getParameterValue(peak_index, i));
+        peakfunction->setCentre(expected_peak_pos);
+        observe_peak_params = false;
+      } else {
+        observe_peak_params =
+            decideToEstimatePeakParams(!foundAnyPeak, peakfunction);
+      }
 
       if (observe_peak_params &&
           m_peakWidthEstimateApproach == EstimatePeakWidth::NoEstimation) {
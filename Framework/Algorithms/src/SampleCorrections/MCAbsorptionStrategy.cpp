@@ -12,12 +12,25 @@
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/CSGObject.h"
 
+#include <cmath>
+
 namespace Mantid {
 using Kernel::DeltaEMode;
 using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+void throwNoValidTrack(const size_t maxScatterAttempts) {
+  throw std::runtime_error("Unable to generate valid track through "
+                           "sample interaction volume after " +
+                           std::to_string(maxScatterAttempts) +
+                           " attempts. Try increasing the maximum "
+                           "threshold or if this does not help then "
+                           "please check the defined shape.");
+}
+} // namespace
+
 /**
  * Constructor
  * @param beamProfile A reference to the object the beam profile
@@ -70,6 +83,73 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
   const auto scatterBounds = m_scatterVol.getBoundingBox();
   const auto nbins = static_cast<int>(lambdas.size());
 
+  if (!m_regenerateTracksForEachLambda && nbins > 0) {
+    // Each pair of tracks is used for every wavelength so accumulate the
+    // attenuation for all of them in one pass over the track segments
+    const std::vector<double> lambdasIn =
+        (m_EMode == DeltaEMode::Direct)
+            ? std::vector<double>(lambdas.size(), lambdaFixed)
+            : lambdas;
+    const std::vector<double> lambdasOut =
+        (m_EMode == DeltaEMode::Indirect)
+            ? std::vector<double>(lambdas.size(), lambdaFixed)
+            : lambdas;
+    std::vector<double> exponents(lambdas.size());
+    for (size_t i = 0; i < m_nevents; ++i) {
+      Geometry::Track beforeScatter;
+      Geometry::Track afterScatter;
+      size_t attempts(0);
+      do {
+        const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+        if (m_scatterVol.calculateBeforeAfterTrack(rng, neutron.startPos,
+                                                   finalPos, beforeScatter,
+                                                   afterScatter, stats))
+          break;
+        ++attempts;
+        if (attempts == m_maxScatterAttempts)
+          throwNoValidTrack(m_maxScatterAttempts);
+      } while (true);
+      std::fill(exponents.begin(), exponents.end(), 0.0);
+      m_scatterVol.addAttenuationExponents(beforeScatter, lambdasIn,
+                                           exponents);
+      m_scatterVol.addAttenuationExponents(afterScatter, lambdasOut,
+                                           exponents);
+      for (int j = 0; j < nbins; ++j) {
+        attenuationFactors[j] += std::exp(exponents[j]);
+      }
+    }
+  } else {
+    calculatePerWavelength(rng, finalPos, lambdas, lambdaFixed,
+                           attenuationFactors, stats);
+  }
+
+  std::transform(attenuationFactors.begin(), attenuationFactors.end(),
+                 attenuationFactors.begin(),
+                 std::bind(std::divides<double>(), std::placeholders::_1,
+                           static_cast<double>(m_nevents)));
+
+  std::fill(attFactorErrors.begin(), attFactorErrors.end(), m_error);
+}
+
+/**
+ * Accumulate the correction for each wavelength point, generating new tracks
+ * for each point if required
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron, assumed to be
+ * where it is detected
+ * @param lambdas Set of wavelength values from the input workspace
+ * @param lambdaFixed Efixed value for a detector ID converted to wavelength
+ * @param attenuationFactors The summed factors are added to this vector
+ * @param stats A statistics class to hold the statistics on the generated
+ * tracks
+ */
+void MCAbsorptionStrategy::calculatePerWavelength(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &finalPos,
+    const std::vector<double> &lambdas, const double lambdaFixed,
+    std::vector<double> &attenuationFactors, MCInteractionStatistics &stats) {
+  const auto scatterBounds = m_scatterVol.getBoundingBox();
+  const auto nbins = static_cast<int>(lambdas.size());
+
   for (size_t i = 0; i < m_nevents; ++i) {
     Geometry::Track beforeScatter;
     Geometry::Track afterScatter;
@@ -104,23 +184,11 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
           break;
         }
         if (attempts == m_maxScatterAttempts) {
-          throw std::runtime_error("Unable to generate valid track through "
-                                   "sample interaction volume after " +
-                                   std::to_string(m_maxScatterAttempts) +
-                                   " attempts. Try increasing the maximum "
-                                   "threshold or if this does not help then "
-                                   "please check the defined shape.");
+          throwNoValidTrack(m_maxScatterAttempts);
         }
       } while (true);
     }
   }
-
-  std::transform(attenuationFactors.begin(), attenuationFactors.end(),
-                 attenuationFactors.begin(),
-                 std::bind(std::divides<double>(), std::placeholders::_1,
-                           static_cast<double>(m_nevents)));
-
-  std::fill(attFactorErrors.begin(), attFactorErrors.end(), m_error);
 }
 
 } // namespace Algorithms
@@ -220,5 +220,26 @@ double MCInteractionVolume::calculateAbsorption(const Track &beforeScatter,
          calculateAttenuation(afterScatter, lambdaAfter);
 }
 
+/**
+ * Add the attenuation exponent, -sum(mu(lambda) * length), of a track to a
+ * set of exponents, one per wavelength. The material of each segment is
+ * looked up once for all of the wavelengths.
+ * @param path A track through the volume
+ * @param lambdas The wavelength for each exponent
+ * @param exponents The exponents to add to. Must be the same size as lambdas
+ */
+void MCInteractionVolume::addAttenuationExponents(
+    const Track &path, const std::vector<double> &lambdas,
+    std::vector<double> &exponents) const {
+  const size_t npoints = lambdas.size();
+  for (const auto &segment : path) {
+    const double length = segment.distInsideObject;
+    const auto &material = segment.object->material();
+    for (size_t j = 0; j < npoints; ++j) {
+      exponents[j] -= material.attenuationCoefficient(lambdas[j]) * length;
+    }
+  }
+}
+
 } // namespace Algorithms
 } // namespace Mantid
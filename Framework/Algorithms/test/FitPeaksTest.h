@@ -244,6 +244,63 @@ public:
     AnalysisDataService::Instance().remove("PeakParametersWS");
   }
 
+  //----------------------------------------------------------------------------------------------
+  /** Test fitting multiple spectra starting from the fits of the neighbouring
+   * spectra
+   */
+  void test_multiPeaksMultiSpectraStartFromNeighbourFit() {
+    std::vector<string> peakparnames;
+    std::vector<double> peakparvalues;
+    createGuassParameters(peakparnames, peakparvalues);
+
+    createTestData(m_inputWorkspaceName);
+
+    FitPeaks fitpeaks;
+    fitpeaks.initialize();
+    fitpeaks.setProperty("InputWorkspace", m_inputWorkspaceName);
+    fitpeaks.setProperty("StartWorkspaceIndex", 0);
+    fitpeaks.setProperty("StopWorkspaceIndex", 2);
+    fitpeaks.setProperty("PeakCenters", "5.0, 10.0");
+    fitpeaks.setProperty("FitWindowBoundaryList", "2.5, 6.5, 8.0, 12.0");
+    fitpeaks.setProperty("PeakParameterNames", peakparnames);
+    fitpeaks.setProperty("PeakParameterValues", peakparvalues);
+    fitpeaks.setProperty("HighBackground", false);
+    fitpeaks.setProperty("ConstrainPeakPositions", false);
+    TS_ASSERT_THROWS_NOTHING(
+        fitpeaks.setProperty("StartFromNeighbourFit", true));
+    fitpeaks.setProperty("OutputWorkspace", "PeakPositionsWS");
+    fitpeaks.setProperty("OutputPeakParametersWorkspace", "PeakParametersWS");
+
+    fitpeaks.execute();
+    TS_ASSERT(fitpeaks.isExecuted());
+    if (!fitpeaks.isExecuted())
+      return;
+
+    // the fits converge to the same peaks as without the warm start
+    API::MatrixWorkspace_sptr main_out_ws =
+        std::dynamic_pointer_cast<API::MatrixWorkspace>(
+            AnalysisDataService::Instance().retrieve("PeakPositionsWS"));
+    TS_ASSERT(main_out_ws);
+    TS_ASSERT_EQUALS(main_out_ws->getNumberHistograms(), 3);
+    const auto &fitted_positions_0 = main_out_ws->histogram(0).y();
+    TS_ASSERT_DELTA(fitted_positions_0[0], 5.0, 1.E-4);
+    TS_ASSERT_DELTA(fitted_positions_0[1], 10.0, 1.E-4);
+    const auto &fitted_positions_2 = main_out_ws->histogram(2).y();
+    TS_ASSERT_DELTA(fitted_positions_2[0], 5.03, 1.E-4);
+    TS_ASSERT_DELTA(fitted_positions_2[1], 10.02, 1.E-4);
+
+    API::ITableWorkspace_sptr param_ws =
+        std::dynamic_pointer_cast<API::ITableWorkspace>(
+            AnalysisDataService::Instance().retrieve("PeakParametersWS"));
+    TS_ASSERT(param_ws);
+    TS_ASSERT_DELTA(param_ws->cell<double>(2, 2), 4., 1E-4);
+    TS_ASSERT_DELTA(param_ws->cell<double>(2, 4), 0.17, 1E-4);
+
+    AnalysisDataService::Instance().remove(m_inputWorkspaceName);
+    AnalysisDataService::Instance().remove("PeakPositionsWS");
+    AnalysisDataService::Instance().remove("PeakParametersWS");
+  }
+
   //----------------------------------------------------------------------------------------------
   /** Test output of effective peak parameters
    * @brief test_effectivePeakParameters
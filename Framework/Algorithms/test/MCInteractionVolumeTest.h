@@ -143,6 +143,17 @@ public:
     const double factorSeg1 = interactor.calculateAbsorption(
         beforeScatter, afterScatter, lambdaBefore, lambdaAfter);
     TS_ASSERT_DELTA(0.030489479, factorSeg1, 1e-8);
+
+    // The exponents for several wavelengths at once must agree
+    std::vector<double> exponents(2, 0.0);
+    interactor.addAttenuationExponents(beforeScatter, {lambdaBefore, 1.0},
+                                       exponents);
+    interactor.addAttenuationExponents(afterScatter, {lambdaAfter, 1.0},
+                                       exponents);
+    TS_ASSERT_DELTA(factorSeg1, std::exp(exponents[0]), 1e-12);
+    TS_ASSERT_DELTA(
+        interactor.calculateAbsorption(beforeScatter, afterScatter, 1.0, 1.0),
+        std::exp(exponents[1]), 1e-12);
   }
 
   void test_Sample_And_Environment_Can_Scatter_In_All_Segments() {
@@ -59,6 +59,9 @@ public:
   const std::string category() const override { return "Optimization"; }
 
 private:
+  /// Names of the workspaces output by a minimizer, keyed by property name
+  using MinimizerWorkspaces = std::vector<std::pair<std::string, std::string>>;
+
   // Overridden Algorithm methods
   void init() override;
   void exec() override;
@@ -71,7 +74,8 @@ private:
                                           bool outputCompositeMembers,
                                           bool outputConvolvedMembers,
                                           const API::IFunction_sptr &ifun,
-                                          const InputSpectraToFit &data);
+                                          const InputSpectraToFit &data,
+                                          MinimizerWorkspaces &minimizerWs);
 
   double calculateLogValue(const std::string &logName,
                            const InputSpectraToFit &data);
@@ -99,7 +103,11 @@ private:
 
   /// Create a minimizer string based on template string provided
   std::string getMinimizerString(const std::string &wsName,
-                                 const std::string &wsIndex);
+                                 const std::string &wsIndex,
+                                 MinimizerWorkspaces &minimizerWs) const;
+
+  /// Check if the minimizer can output workspaces
+  bool minimizerHasWorkspaceOutputs() const;
 
   /// Base name of output workspace
   std::string m_baseName;
@@ -14,6 +14,10 @@
 #include "MantidCurveFitting/GSLVector.h"
 
 namespace Mantid {
+namespace API {
+class CompositeDomain;
+class MultiDomainFunction;
+} // namespace API
 namespace CurveFitting {
 namespace CostFunctions {
 /** Cost function for least squares
@@ -43,6 +47,11 @@ protected:
                           API::FunctionValues_sptr values,
                           bool evalDeriv = true,
                           bool evalHessian = true) const override;
+  /// Add the contributions of a MultiDomainFunction domain by domain
+  void addMultiDomainValDerivHessian(const API::MultiDomainFunction &function,
+                                     const API::CompositeDomain &domain,
+                                     API::FunctionValues_sptr values,
+                                     bool evalHessian) const;
 
   /// Get mapped weights from FunctionValues
   virtual std::vector<double>
@@ -12,6 +12,8 @@
 #include "MantidCurveFitting/GSLVector.h"
 #include "MantidKernel/System.h"
 
+#include <random>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace CostFunctions {
@@ -162,6 +164,9 @@ private:
   std::vector<size_t> m_numInactiveRegenerations;
   /// To track convergence through immobility
   std::vector<int> m_changesOld;
+  /// Random number generator of the chain. Each minimizer owns its generator
+  /// so that fits running concurrently are independent and reproducible.
+  std::mt19937 m_rng;
 };
 
 /// Used to access the setDirty() protected member
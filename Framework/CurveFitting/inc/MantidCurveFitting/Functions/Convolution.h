@@ -134,10 +134,17 @@ protected:
   void init() override;
 
 private:
+  struct FFTWorkspace;
+  /// Get the cached FFT workspace for data of the given size
+  FFTWorkspace &fftWorkspace(size_t nData) const;
+
   /// Keep the Fourier transform of the resolution function (divided by the
   /// step in xValues) when in FFT mode, and the inverted resolution if in
   /// Direct mode
   mutable std::vector<double> m_resolution;
+  /// GSL workspace and wavetables reused by FFT mode while the data size is
+  /// unchanged
+  mutable std::shared_ptr<FFTWorkspace> m_fftWorkspace;
 };
 
 } // namespace Functions
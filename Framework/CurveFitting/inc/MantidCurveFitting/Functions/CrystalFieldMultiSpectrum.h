@@ -38,6 +38,9 @@ protected:
   void updateTargetFunction() const override;
 
 private:
+  /// Calculate the eigensystem of the Hamiltonian or take it from the cache
+  void calculateEigenSystem(DoubleFortranVector &en, ComplexFortranMatrix &wf,
+                            ComplexFortranMatrix &ham, int &nre) const;
   /// Build a function for a single spectrum.
   API::IFunction_sptr buildSpectrum(int nre, const DoubleFortranVector &en,
                                     const ComplexFortranMatrix &wf,
@@ -68,6 +71,17 @@ private:
   mutable std::vector<double> m_temperatures;
   /// Cache the default peak FWHMs
   mutable std::vector<double> m_FWHMs;
+  /// An eigensystem with the values of the source parameters it was
+  /// calculated for
+  struct EigenSystem {
+    std::vector<double> parameters;
+    DoubleFortranVector en;
+    ComplexFortranMatrix wf;
+    ComplexFortranMatrix ham;
+    int nre = 0;
+  };
+  /// The most recently used eigensystems, most recent first
+  mutable std::vector<EigenSystem> m_eigenSystems;
 };
 
 } // namespace Functions
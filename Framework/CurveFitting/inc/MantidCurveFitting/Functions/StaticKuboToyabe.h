@@ -35,6 +35,8 @@ public:
 protected:
   void function1D(double *out, const double *xValues,
                   const size_t nData) const override;
+  void functionDeriv1D(API::Jacobian *out, const double *xValues,
+                       const size_t nData) override;
 
   /// overwrite IFunction base class method that declares function parameters
   void init() override;
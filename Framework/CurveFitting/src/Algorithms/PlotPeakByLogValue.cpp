@@ -7,6 +7,7 @@
 #include "MantidKernel/StringTokenizer.h"
 #include <algorithm>
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/algorithm/string/trim.hpp>
 #include <boost/lexical_cast.hpp>
 #include <cmath>
 #include <fstream>
@@ -33,6 +34,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
 namespace {
@@ -216,10 +218,32 @@ void PlotPeakByLogValue::exec() {
     parameterWorkspaces.reserve(wsNames.size());
   }
 
+  // Individual fits of a single domain function do not depend on each other
+  // and are run in parallel, each starting from its own copy of the function.
+  // Minimizers that output workspaces, such as FABADA, are run serially.
+  const bool fitInParallel = individual && !isMultiDomainFunction &&
+                             !createFitOutput &&
+                             !minimizerHasWorkspaceOutputs();
+  const auto nInputs = static_cast<int>(wsNames.size());
+  std::vector<IFunction_sptr> fittedFunctions(wsNames.size());
+  std::vector<MinimizerWorkspaces> minimizerWorkspaces(wsNames.size());
+  std::vector<double> chi2s(wsNames.size());
+  // Find the log values: each is either a log-file value or simply the
+  // workspace number. Reading a log may sort it, so this is not done in
+  // parallel, as several inputs can share a workspace.
+  std::vector<double> logValues(wsNames.size());
+  for (size_t i = 0; i < wsNames.size(); ++i) {
+    if (wsNames[i].ws && wsNames[i].i >= 0) {
+      logValues[i] = calculateLogValue(logName, wsNames[i]);
+    }
+  }
+
   double dProg = 1. / static_cast<double>(wsNames.size());
   double Prog = 0.;
-  for (int i = 0; i < static_cast<int>(wsNames.size()); ++i) {
-    InputSpectraToFit data = wsNames[i];
+  PARALLEL_FOR_IF(fitInParallel)
+  for (int i = 0; i < nInputs; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const InputSpectraToFit &data = wsNames[i];
 
     if (!data.ws) {
       g_log.warning() << "Cannot access workspace " << data.name << '\n';
@@ -232,12 +256,14 @@ void PlotPeakByLogValue::exec() {
       continue;
     }
 
-    IFunction_sptr ifun =
-        setupFunction(individual, passWSIndexToFunction, inputFunction,
-                      initialParams, isMultiDomainFunction, i, data);
+    IFunction_sptr ifun = setupFunction(
+        individual, passWSIndexToFunction,
+        fitInParallel ? inputFunction->clone() : inputFunction, initialParams,
+        isMultiDomainFunction, i, data);
 
     auto fit = runSingleFit(createFitOutput, outputCompositeMembers,
-                            outputConvolvedMembers, ifun, data);
+                            outputConvolvedMembers, ifun, data,
+                            minimizerWorkspaces[i]);
 
     ifun = fit->getProperty("Function");
     double chi2 = fit->getProperty("OutputChi2overDoF");
@@ -256,15 +282,31 @@ void PlotPeakByLogValue::exec() {
     g_log.debug() << "Fit result " << fit->getPropertyValue("OutputStatus")
                   << ' ' << chi2 << '\n';
 
-    // Find the log value: it is either a log-file value or
-    // simply the workspace number
-    double logValue = calculateLogValue(logName, data);
-    appendTableRow(isDataName, result, ifun.get(), data, logValue, chi2);
+    // The table holds the parameter values, so copy them before a later
+    // sequential fit modifies the function
+    fittedFunctions[i] = fitInParallel ? ifun : ifun->clone();
+    chi2s[i] = chi2;
 
-    Prog += dProg;
-    std::string current = std::to_string(i);
-    progress(Prog, ("Fitting Workspace: (" + current + ") - "));
+    PARALLEL_CRITICAL(PlotPeakByLogValue_progress) {
+      Prog += dProg;
+      std::string current = std::to_string(i);
+      progress(Prog, ("Fitting Workspace: (" + current + ") - "));
+    }
     interruption_point();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Fill the table and record the minimizer outputs in the order of the inputs
+  for (size_t i = 0; i < wsNames.size(); ++i) {
+    if (fittedFunctions[i]) {
+      appendTableRow(isDataName, result, fittedFunctions[i].get(), wsNames[i],
+                     logValues[i], chi2s[i]);
+    }
+    for (const auto &minimizerWorkspace : minimizerWorkspaces[i]) {
+      m_minimizerWorkspaces[minimizerWorkspace.first].emplace_back(
+          minimizerWorkspace.second);
+    }
   }
   finaliseOutputWorkspaces(createFitOutput, fitWorkspaces, parameterWorkspaces,
                            covarianceWorkspaces);
@@ -387,7 +429,7 @@ PlotPeakByLogValue::createResultsTable(const std::string &logName,
 std::shared_ptr<Algorithm> PlotPeakByLogValue::runSingleFit(
     bool createFitOutput, bool outputCompositeMembers,
     bool outputConvolvedMembers, const IFunction_sptr &ifun,
-    const InputSpectraToFit &data) {
+    const InputSpectraToFit &data, MinimizerWorkspaces &minimizerWs) {
   g_log.debug() << "Fitting " << data.ws->getName() << " index " << data.i
                 << " with \n";
   g_log.debug() << ifun->asString() << '\n';
@@ -412,8 +454,9 @@ std::shared_ptr<Algorithm> PlotPeakByLogValue::runSingleFit(
   fit->setPropertyValue("StartX", this->getPropertyValue("StartX"));
   fit->setPropertyValue("EndX", this->getPropertyValue("EndX"));
   fit->setProperty("IgnoreInvalidData", ignoreInvalidData);
-  fit->setPropertyValue("Minimizer",
-                        this->getMinimizerString(data.name, spectrum_index));
+  fit->setPropertyValue(
+      "Minimizer",
+      this->getMinimizerString(data.name, spectrum_index, minimizerWs));
   fit->setPropertyValue("CostFunction", this->getPropertyValue("CostFunction"));
   fit->setPropertyValue("MaxIterations",
                         this->getPropertyValue("MaxIterations"));
@@ -473,8 +516,10 @@ void PlotPeakByLogValue::setWorkspaceIndexAttribute(const IFunction_sptr &fun,
   }
 }
 
-std::string PlotPeakByLogValue::getMinimizerString(const std::string &wsName,
-                                                   const std::string &wsIndex) {
+std::string
+PlotPeakByLogValue::getMinimizerString(const std::string &wsName,
+                                       const std::string &wsIndex,
+                                       MinimizerWorkspaces &minimizerWs) const {
   std::string format = getPropertyValue("Minimizer");
   std::string wsBaseName = wsName + "_" + wsIndex;
   boost::replace_all(format, "$wsname", wsName);
@@ -491,7 +536,7 @@ std::string PlotPeakByLogValue::getMinimizerString(const std::string &wsName,
       const std::string &wsPropValue = minimizerProp->value();
       if (!wsPropValue.empty()) {
         const std::string &wsPropName = minimizerProp->name();
-        m_minimizerWorkspaces[wsPropName].emplace_back(wsPropValue);
+        minimizerWs.emplace_back(wsPropName, wsPropValue);
       }
     }
   }
@@ -499,6 +544,18 @@ std::string PlotPeakByLogValue::getMinimizerString(const std::string &wsName,
   return format;
 }
 
+bool PlotPeakByLogValue::minimizerHasWorkspaceOutputs() const {
+  const std::string format = getPropertyValue("Minimizer");
+  const auto type = boost::trim_copy(format.substr(0, format.find(',')));
+  auto minimizer = FuncMinimizerFactory::Instance().create(type);
+  const auto minimizerProps = minimizer->getProperties();
+  return std::any_of(minimizerProps.cbegin(), minimizerProps.cend(),
+                     [](const Kernel::Property *prop) {
+                       return dynamic_cast<const API::WorkspaceProperty<> *>(
+                                  prop) != nullptr;
+                     });
+}
+
 } // namespace Algorithms
 } // namespace CurveFitting
 } // namespace Mantid
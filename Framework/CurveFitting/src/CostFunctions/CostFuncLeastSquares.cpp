@@ -11,6 +11,7 @@
 #include "MantidAPI/CompositeDomain.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/IConstraint.h"
+#include "MantidAPI/MultiDomainFunction.h"
 #include "MantidCurveFitting/Jacobian.h"
 #include "MantidCurveFitting/SeqDomain.h"
 #include "MantidKernel/Logger.h"
@@ -74,68 +75,224 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function,
                                               bool evalHessian) const {
   UNUSED_ARG(evalDeriv);
   function->function(*domain, *values);
+  auto multiDomainFunction =
+      std::dynamic_pointer_cast<API::MultiDomainFunction>(function);
+  auto compositeDomain =
+      std::dynamic_pointer_cast<API::CompositeDomain>(domain);
+  if (multiDomainFunction && compositeDomain &&
+      !multiDomainFunction->getAttribute("NumDeriv").asBool()) {
+    addMultiDomainValDerivHessian(*multiDomainFunction, *compositeDomain,
+                                  values, evalHessian);
+    return;
+  }
   size_t np = function->nParams(); // number of parameters
   size_t ny = values->size();      // number of data points
   Jacobian jacobian(ny, np);
   function->functionDeriv(*domain, jacobian);
 
-  size_t iActiveP = 0;
-  double fVal = 0.0;
   std::vector<double> weights = getFitWeights(values);
 
+  // Weighted residuals and the weighted columns of the Jacobian for the
+  // active parameters
+  GSLVector residuals(ny);
+  double fVal = 0.0;
+  for (size_t i = 0; i < ny; ++i) {
+    double y = (values->getCalculated(i) - values->getFitData(i)) * weights[i];
+    residuals.set(i, y);
+    fVal += y * y;
+  }
+
+  std::vector<size_t> activeParams;
+  activeParams.reserve(np);
   for (size_t ip = 0; ip < np; ++ip) {
-    if (!function->isActive(ip))
-      continue;
-    double d = 0.0;
-    for (size_t i = 0; i < ny; ++i) {
-      double calc = values->getCalculated(i);
-      double obs = values->getFitData(i);
-      double w = weights[i];
-      double y = (calc - obs) * w;
-      d += y * jacobian.get(i, ip) * w;
-      if (iActiveP == 0) {
-        fVal += y * y;
+    if (function->isActive(ip))
+      activeParams.emplace_back(ip);
+  }
+  const size_t na = activeParams.size();
+  if (na == 0) {
+    PARALLEL_ATOMIC
+    m_value += 0.5 * fVal;
+    return;
+  }
+
+  GSLMatrix weightedJacobian(ny, na);
+  for (size_t i = 0; i < ny; ++i) {
+    double w = weights[i];
+    for (size_t ia = 0; ia < na; ++ia) {
+      weightedJacobian.set(i, ia, jacobian.get(i, activeParams[ia]) * w);
+    }
+  }
+
+  // The contributions of this domain are computed into local buffers and
+  // added to the totals under a single lock, so parallel domains do not
+  // contend for every element
+  GSLVector der(na);
+  gsl_blas_dgemv(CblasTrans, 1.0, weightedJacobian.gsl(), residuals.gsl(), 0.0,
+                 der.gsl());
+
+  GSLMatrix hessian;
+  if (evalHessian) {
+    hessian.resize(na, na);
+    gsl_blas_dsyrk(CblasLower, CblasTrans, 1.0, weightedJacobian.gsl(), 0.0,
+                   hessian.gsl());
+    for (size_t i1 = 0; i1 < na; ++i1) {
+      for (size_t i2 = 0; i2 < i1; ++i2) {
+        hessian.set(i2, i1, hessian.get(i1, i2));
       }
     }
-    PARALLEL_CRITICAL(der_set) {
-      double der = m_der.get(iActiveP);
-      m_der.set(iActiveP, der + d);
+  }
+
+  PARALLEL_CRITICAL(cost_func_add) {
+    m_value += 0.5 * fVal;
+    m_der += der;
+    if (evalHessian) {
+      m_hessian += hessian;
     }
-    ++iActiveP;
   }
+}
 
-  PARALLEL_ATOMIC
-  m_value += 0.5 * fVal;
+/**
+ * Update the cost function, derivatives and hessian of a MultiDomainFunction
+ * one member domain at a time. A domain depends only on the parameters of the
+ * member functions applied to it, so its Jacobian has just those columns and
+ * the mostly zero Jacobian of the whole joint domain is never formed.
+ * @param function :: A MultiDomainFunction already evaluated on the domain.
+ * @param domain :: The composite domain.
+ * @param values :: The fit function values
+ * @param evalHessian :: Flag to evaluate the Hessian
+ */
+void CostFuncLeastSquares::addMultiDomainValDerivHessian(
+    const API::MultiDomainFunction &function,
+    const API::CompositeDomain &domain, API::FunctionValues_sptr values,
+    bool evalHessian) const {
+  const size_t np = function.nParams();
+  const size_t nDomains = domain.getNParts();
 
-  if (!evalHessian)
-    return;
+  // Index of each declared parameter among the active ones, np if inactive
+  std::vector<size_t> activeIndices(np, np);
+  size_t na = 0;
+  for (size_t ip = 0; ip < np; ++ip) {
+    if (function.isActive(ip))
+      activeIndices[ip] = na++;
+  }
+
+  // Member functions applied to each domain and the offsets of their
+  // parameters in the MultiDomainFunction
+  std::vector<std::vector<size_t>> domainFunctions(nDomains);
+  std::vector<size_t> paramOffsets(function.nFunctions());
+  size_t paramOffset = 0;
+  for (size_t iFun = 0; iFun < function.nFunctions(); ++iFun) {
+    paramOffsets[iFun] = paramOffset;
+    paramOffset += function.getFunction(iFun)->nParams();
+    std::vector<size_t> domains;
+    function.getDomainIndices(iFun, nDomains, domains);
+    for (auto iDomain : domains) {
+      domainFunctions[iDomain].emplace_back(iFun);
+    }
+  }
+
+  std::vector<double> weights = getFitWeights(values);
+
+  double fVal = 0.0;
+  GSLVector der;
+  GSLMatrix hessian;
+  if (na > 0) {
+    der.resize(na);
+    der.zero();
+    if (evalHessian) {
+      hessian.resize(na, na);
+      hessian.zero();
+    }
+  }
+
+  size_t valueOffset = 0;
+  for (size_t iDomain = 0; iDomain < nDomains; ++iDomain) {
+    const API::FunctionDomain &localDomain = domain.getDomain(iDomain);
+    const size_t ny = localDomain.size();
+    if (ny == 0)
+      continue;
 
-  size_t i1 = 0;                  // active parameter index
-  for (size_t i = 0; i < np; ++i) // over parameters
-  {
-    if (!function->isActive(i))
+    GSLVector residuals(ny);
+    for (size_t i = 0; i < ny; ++i) {
+      const size_t iY = valueOffset + i;
+      double y = (values->getCalculated(iY) - values->getFitData(iY)) *
+                 weights[iY];
+      residuals.set(i, y);
+      fVal += y * y;
+    }
+
+    // Active parameters of the member functions applied to this domain
+    std::vector<size_t> columns;
+    for (auto iFun : domainFunctions[iDomain]) {
+      const size_t nFunParams = function.getFunction(iFun)->nParams();
+      for (size_t ip = 0; ip < nFunParams; ++ip) {
+        const size_t ia = activeIndices[paramOffsets[iFun] + ip];
+        if (ia < np)
+          columns.emplace_back(ia);
+      }
+    }
+    const size_t nColumns = columns.size();
+    if (nColumns == 0) {
+      valueOffset += ny;
       continue;
-    size_t i2 = 0;                  // active parameter index
-    for (size_t j = 0; j <= i; ++j) // over ~ half of parameters
-    {
-      if (!function->isActive(j))
-        continue;
-      double d = 0.0;
-      for (size_t k = 0; k < ny; ++k) // over fitting data
-      {
-        double w = weights[k];
-        d += jacobian.get(k, i) * jacobian.get(k, j) * w * w;
+    }
+
+    GSLMatrix weightedJacobian(ny, nColumns);
+    size_t column = 0;
+    for (auto iFun : domainFunctions[iDomain]) {
+      auto memberFunction = function.getFunction(iFun);
+      const size_t nFunParams = memberFunction->nParams();
+      Jacobian jacobian(ny, nFunParams);
+      memberFunction->functionDeriv(localDomain, jacobian);
+      for (size_t ip = 0; ip < nFunParams; ++ip) {
+        if (activeIndices[paramOffsets[iFun] + ip] == np)
+          continue;
+        for (size_t i = 0; i < ny; ++i) {
+          weightedJacobian.set(i, column,
+                               jacobian.get(i, ip) * weights[valueOffset + i]);
+        }
+        ++column;
       }
-      PARALLEL_CRITICAL(hessian_set) {
-        double h = m_hessian.get(i1, i2);
-        m_hessian.set(i1, i2, h + d);
-        if (i1 != i2) {
-          m_hessian.set(i2, i1, h + d);
+    }
+
+    GSLVector localDer(nColumns);
+    gsl_blas_dgemv(CblasTrans, 1.0, weightedJacobian.gsl(), residuals.gsl(),
+                   0.0, localDer.gsl());
+    for (size_t k = 0; k < nColumns; ++k) {
+      der.set(columns[k], der.get(columns[k]) + localDer.get(k));
+    }
+
+    if (evalHessian) {
+      GSLMatrix localHessian(nColumns, nColumns);
+      gsl_blas_dsyrk(CblasLower, CblasTrans, 1.0, weightedJacobian.gsl(), 0.0,
+                     localHessian.gsl());
+      for (size_t k1 = 0; k1 < nColumns; ++k1) {
+        const size_t i1 = columns[k1];
+        for (size_t k2 = 0; k2 <= k1; ++k2) {
+          const size_t i2 = columns[k2];
+          const double h = localHessian.get(k1, k2);
+          hessian.set(i1, i2, hessian.get(i1, i2) + h);
+          if (i1 != i2) {
+            hessian.set(i2, i1, hessian.get(i2, i1) + h);
+          }
         }
       }
-      ++i2;
     }
-    ++i1;
+    valueOffset += ny;
+  }
+
+  if (na == 0) {
+    PARALLEL_ATOMIC
+    m_value += 0.5 * fVal;
+    return;
+  }
+
+  PARALLEL_CRITICAL(cost_func_add) {
+    m_value += 0.5 * fVal;
+    m_der += der;
+    if (evalHessian) {
+      m_hessian += hessian;
+    }
   }
 }
 
@@ -18,6 +18,7 @@
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 using namespace Mantid::API;
 
@@ -121,6 +122,9 @@ void CostFuncPoisson::calculateDerivative(API::IFunction &function,
 
   size_t activeParamIndex = 0;
   double costVal = 0.0;
+  // Accumulate locally and add to the totals under a single lock
+  std::vector<double> derivatives;
+  derivatives.reserve(numParams);
 
   for (size_t paramIndex = 0; paramIndex < numParams; ++paramIndex) {
     if (!function.isActive(paramIndex))
@@ -160,15 +164,16 @@ void CostFuncPoisson::calculateDerivative(API::IFunction &function,
         determinant += jacobian.get(i, paramIndex) * (1.0 - obs / calc);
       }
     }
-    PARALLEL_CRITICAL(der_set) {
-      double der = m_der.get(activeParamIndex);
-      m_der.set(activeParamIndex, der + determinant);
-    }
+    derivatives.emplace_back(determinant);
     ++activeParamIndex;
   }
 
-  PARALLEL_ATOMIC
-  m_value += 2.0 * costVal;
+  PARALLEL_CRITICAL(cost_func_add) {
+    m_value += 2.0 * costVal;
+    for (size_t i = 0; i < derivatives.size(); ++i) {
+      m_der.set(i, m_der.get(i) + derivatives[i]);
+    }
+  }
 }
 
 void CostFuncPoisson::calculateHessian(API::IFunction &function,
@@ -179,6 +184,8 @@ void CostFuncPoisson::calculateHessian(API::IFunction &function,
 
   Jacobian jacobian(numDataPoints, numParams);
   function.functionDeriv(domain, jacobian);
+  // Accumulate locally and add to the totals under a single lock
+  GSLMatrix hessian(m_hessian.size1(), m_hessian.size2());
 
   size_t activeParamFirstIndex =
       0; // The params are split into two halves and iterated through
@@ -229,18 +236,16 @@ void CostFuncPoisson::calculateHessian(API::IFunction &function,
           }
         }
       }
-      PARALLEL_CRITICAL(hessian_set) {
-        double h =
-            m_hessian.get(activeParamFirstIndex, activeParamSecondIndex) + d;
-        m_hessian.set(activeParamFirstIndex, activeParamSecondIndex, h);
-        if (activeParamFirstIndex != activeParamSecondIndex) {
-          m_hessian.set(activeParamSecondIndex, activeParamFirstIndex, h);
-        }
+      hessian.set(activeParamFirstIndex, activeParamSecondIndex, d);
+      if (activeParamFirstIndex != activeParamSecondIndex) {
+        hessian.set(activeParamSecondIndex, activeParamFirstIndex, d);
       }
       ++activeParamSecondIndex;
     }
     ++activeParamFirstIndex;
   }
+
+  PARALLEL_CRITICAL(cost_func_add) { m_hessian += hessian; }
 }
 
 } // namespace CostFunctions
@@ -51,8 +51,6 @@ const size_t LOWER_CONVERGENCE_LIMIT = 350;
 const size_t JUMP_CHECKING_RATE = 200;
 // low jump limit
 const double LOW_JUMP_LIMIT = 1e-25;
-// random number generator
-std::mt19937 rng;
 
 API::MatrixWorkspace_sptr
 createWorkspace(std::vector<double> const &xValues,
@@ -85,7 +83,7 @@ FABADAMinimizer::FABADAMinimizer()
       m_parConverged(), m_criteria(), m_maxIter(0), m_parChanged(),
       m_temperature(0.), m_counterGlobal(0), m_simAnnealingItStep(0),
       m_leftRefrPoints(0), m_tempStep(0.), m_overexploration(false),
-      m_nParams(0), m_numInactiveRegenerations(), m_changesOld() {
+      m_nParams(0), m_numInactiveRegenerations(), m_changesOld(), m_rng() {
   declareProperty("ChainLength", static_cast<size_t>(10000),
                   "Length of the converged chain.");
   declareProperty("StepsBetweenValues", 10,
@@ -99,6 +97,9 @@ FABADAMinimizer::FABADAMinimizer()
                   " a certain parameter to be converged");
   declareProperty("JumpAcceptanceRate", 0.6666666,
                   "Desired jumping acceptance rate");
+  declareProperty("Seed", static_cast<int>(std::mt19937::default_seed),
+                  "Seed for the random number generator. Fits with different"
+                  " seeds draw different random sequences.");
   // Simulated Annealing properties
   declareProperty("SimAnnealingApplied", false,
                   "If minimization should be run with Simulated"
@@ -162,6 +163,9 @@ void FABADAMinimizer::initialize(API::ICostFunction_sptr function,
   m_fitFunction = m_leastSquares->getFittingFunction();
   m_counter = 0;
   m_counterGlobal = 0;
+  // Every chain starts from the random sequence given by the seed
+  const int seed = getProperty("Seed");
+  m_rng.seed(static_cast<std::mt19937::result_type>(seed));
   m_converged = false;
   m_maxIter = maxIterations;
 
@@ -384,7 +388,7 @@ void FABADAMinimizer::finalize() {
  * @return :: the step
  */
 double FABADAMinimizer::gaussianStep(const double &jump) {
-  return Kernel::normal_distribution<double>(0.0, std::abs(jump))(rng);
+  return Kernel::normal_distribution<double>(0.0, std::abs(jump))(m_rng);
 }
 
 /** If the new point is out of its bounds, it is changed to fit in the bound
@@ -506,7 +510,7 @@ void FABADAMinimizer::algorithmDisplacement(const size_t &parameterIndex,
     double prob = exp((m_chi2 - chi2New) / (2.0 * m_temperature));
 
     // Decide if changing or not
-    double p = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    double p = std::uniform_real_distribution<double>(0.0, 1.0)(m_rng);
     if (p <= prob) {
       for (size_t j = 0; j < m_nParams; j++) {
         m_chain[j].emplace_back(newParameters.get(j));
@@ -8,6 +8,7 @@
 
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/IPowderDiffPeakFunction.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidCurveFitting/Functions/Bk2BkExpConvPV.h"
 #include "MantidKernel/System.h"
@@ -228,18 +229,8 @@ std::complex<double> Bk2BkExpConvPV::E1(std::complex<double> z) const {
 
     e1 = -e1 - log(z) + (z * e1);
   } else {
-    std::complex<double> ct0(0.0, 0.0);
-    for (int k = 120; k > 0; --k) {
-      std::complex<double> dk(double(k), 0.0);
-      ct0 = dk / (10.0 + dk / (z + ct0));
-    } // ENDFOR k
-
-    e1 = 1.0 / (z + ct0);
-    e1 = e1 * exp(-z);
-    if (rz < 0.0 && fabs(imag(z)) < 1.0E-10) {
-      std::complex<double> u(0.0, 1.0);
-      e1 = e1 - (M_PI * u);
-    }
+    // The same continued fraction as the shared implementation
+    e1 = API::E1(z);
   }
 
   return e1;
@@ -71,22 +71,38 @@ void Convolution::setAttribute(const std::string &attName,
   CompositeFunction::setAttribute(attName, att);
 }
 
-namespace {
-// anonymous namespace for local definitions
-
-// A struct incapsulating workspaces for real fft
-struct RealFFTWorkspace {
-  explicit RealFFTWorkspace(size_t nData)
-      : workspace(gsl_fft_real_workspace_alloc(nData)),
-        wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
-  ~RealFFTWorkspace() {
+/// GSL workspace and wavetables for real FFTs of one data size. They are
+/// kept between calls as fits evaluate the function on the same domain many
+/// times.
+struct Convolution::FFTWorkspace {
+  explicit FFTWorkspace(size_t nData)
+      : size(nData), workspace(gsl_fft_real_workspace_alloc(nData)),
+        wavetable(gsl_fft_real_wavetable_alloc(nData)),
+        inverseWavetable(gsl_fft_halfcomplex_wavetable_alloc(nData)) {}
+  ~FFTWorkspace() {
+    gsl_fft_halfcomplex_wavetable_free(inverseWavetable);
     gsl_fft_real_wavetable_free(wavetable);
     gsl_fft_real_workspace_free(workspace);
   }
+  FFTWorkspace(const FFTWorkspace &) = delete;
+  FFTWorkspace &operator=(const FFTWorkspace &) = delete;
+  size_t size;
   gsl_fft_real_workspace *workspace;
   gsl_fft_real_wavetable *wavetable;
+  gsl_fft_halfcomplex_wavetable *inverseWavetable;
 };
-} // namespace
+
+/**
+ * Get the FFT workspace for the given data size, allocating it if the size
+ * has changed since the last call.
+ * @param nData :: The size of the data to transform
+ */
+Convolution::FFTWorkspace &Convolution::fftWorkspace(size_t nData) const {
+  if (!m_fftWorkspace || m_fftWorkspace->size != nData) {
+    m_fftWorkspace = std::make_shared<FFTWorkspace>(nData);
+  }
+  return *m_fftWorkspace;
+}
 
 /**
  * Calculates convolution of the two member functions. Switches from FFT mode
@@ -134,10 +150,10 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
   refreshResolution();
-  RealFFTWorkspace workspace(nData);
+  const FFTWorkspace &workspace = fftWorkspace(nData);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
-  if (m_resolution.empty()) {
+  if (m_resolution.size() != nData) {
     m_resolution.resize(nData);
     // the resolution must be defined on interval -L < xr < L, L ==
     // (xValues[nData-1] - xValues[0]) / 2
@@ -265,11 +281,8 @@ void Convolution::functionFFTMode(const FunctionDomain &domain,
     }
 
     // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r =
-        gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r,
+    gsl_fft_halfcomplex_inverse(out, 1, nData, workspace.inverseWavetable,
                                 workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
@@ -346,9 +359,7 @@ void Convolution::functionDirectMode(const FunctionDomain &domain,
   if (!resolution) {
     throw std::runtime_error("Convolution can work only with 1D functions");
   }
-  if (m_resolution.empty()) {
-    m_resolution.resize(nData);
-  }
+  m_resolution.resize(nData);
   resolution->function1D(m_resolution.data(), xValues, nData);
 
   // Reverse the axis of the resolution data
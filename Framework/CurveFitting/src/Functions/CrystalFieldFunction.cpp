@@ -157,12 +157,18 @@ CrystalFieldFunction::createEquivalentFunctions() const {
 void CrystalFieldFunction::setParameter(size_t i, const double &value,
                                         bool explicitlySet) {
   checkSourceFunction();
+  // The target is rebuilt only if a control or source parameter actually
+  // changes, e.g. not when a fit resets the parameters to their current values.
   if (i < m_nControlParams) {
+    if (value != m_control.getParameter(i)) {
+      m_dirtyTarget = true;
+    }
     m_control.setParameter(i, value, explicitlySet);
-    m_dirtyTarget = true;
   } else if (i < m_nControlSourceParams) {
+    if (value != m_source->getParameter(i - m_nControlParams)) {
+      m_dirtyTarget = true;
+    }
     m_source->setParameter(i - m_nControlParams, value, explicitlySet);
-    m_dirtyTarget = true;
   } else {
     checkTargetFunction();
     m_target->setParameter(i - m_nControlSourceParams, value, explicitlySet);
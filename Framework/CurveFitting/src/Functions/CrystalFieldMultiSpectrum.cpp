@@ -23,6 +23,8 @@
 #include "MantidKernel/Exception.h"
 #include <boost/regex.hpp>
 
+#include <algorithm>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace Functions {
@@ -215,9 +217,56 @@ void CrystalFieldMultiSpectrum::setAttribute(const std::string &name,
           "Temperatures must be defined before resolution model");
     }
   }
+  // Attributes of the source can change the Hamiltonian
+  m_eigenSystems.clear();
   FunctionGenerator::setAttribute(name, attr);
 }
 
+/**
+ * Calculate the eigensystem of the crystal field Hamiltonian including the
+ * Zeeman term. The Hamiltonian depends only on the source parameters, so the
+ * results for the last few sets of their values are kept. A numerical
+ * derivative with respect to a peak or physical property parameter, or the
+ * evaluation following a derivative, then needs no diagonalisation.
+ * @param en :: [output] Eigenvalues
+ * @param wf :: [output] Eigenvectors
+ * @param ham :: [output] The Hamiltonian
+ * @param nre :: [output] The ion's number
+ */
+void CrystalFieldMultiSpectrum::calculateEigenSystem(
+    DoubleFortranVector &en, ComplexFortranMatrix &wf,
+    ComplexFortranMatrix &ham, int &nre) const {
+  const size_t maxCacheSize = 2;
+  std::vector<double> parameters(m_source->nParams());
+  for (size_t i = 0; i < parameters.size(); ++i) {
+    parameters[i] = m_source->getParameter(i);
+  }
+  auto cached = std::find_if(
+      m_eigenSystems.begin(), m_eigenSystems.end(),
+      [&parameters](const EigenSystem &es) {
+        return es.parameters == parameters;
+      });
+  if (cached == m_eigenSystems.end()) {
+    EigenSystem es;
+    ComplexFortranMatrix hz;
+    auto &peakCalculator = dynamic_cast<Peaks &>(*m_source);
+    peakCalculator.calculateEigenSystem(es.en, es.wf, es.ham, hz, es.nre);
+    es.ham += hz;
+    es.parameters = std::move(parameters);
+    if (m_eigenSystems.size() == maxCacheSize) {
+      m_eigenSystems.pop_back();
+    }
+    m_eigenSystems.insert(m_eigenSystems.begin(), std::move(es));
+  } else if (cached != m_eigenSystems.begin()) {
+    std::rotate(m_eigenSystems.begin(), cached, cached + 1);
+  }
+  const auto &es = m_eigenSystems.front();
+  en = es.en;
+  wf = es.wf;
+  ham = es.ham;
+  nre = es.nre;
+}
+
 /// Uses source to calculate peak centres and intensities
 /// then populates m_spectrum with peaks of type given in PeakShape attribute.
 void CrystalFieldMultiSpectrum::buildTargetFunction() const {
@@ -229,11 +278,8 @@ void CrystalFieldMultiSpectrum::buildTargetFunction() const {
   DoubleFortranVector en;
   ComplexFortranMatrix wf;
   ComplexFortranMatrix ham;
-  ComplexFortranMatrix hz;
   int nre = 0;
-  auto &peakCalculator = dynamic_cast<Peaks &>(*m_source);
-  peakCalculator.calculateEigenSystem(en, wf, ham, hz, nre);
-  ham += hz;
+  calculateEigenSystem(en, wf, ham, nre);
 
   // Get the temperatures from the attribute
   m_temperatures = getAttribute("Temperatures").asVector();
@@ -426,11 +472,8 @@ void CrystalFieldMultiSpectrum::updateTargetFunction() const {
   DoubleFortranVector en;
   ComplexFortranMatrix wf;
   ComplexFortranMatrix ham;
-  ComplexFortranMatrix hz;
   int nre = 0;
-  auto &peakCalculator = dynamic_cast<Peaks &>(*m_source);
-  peakCalculator.calculateEigenSystem(en, wf, ham, hz, nre);
-  ham += hz;
+  calculateEigenSystem(en, wf, ham, nre);
 
   auto &fun = dynamic_cast<MultiDomainFunction &>(*m_target);
   try {
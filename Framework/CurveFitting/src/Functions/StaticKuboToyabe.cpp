@@ -8,7 +8,9 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/StaticKuboToyabe.h"
+#include "MantidAPI/DualNumber.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/Jacobian.h"
 #include <cmath>
 
 namespace Mantid {
@@ -21,6 +23,16 @@ using namespace Kernel;
 
 using namespace API;
 
+namespace {
+/// The function value at time x, templated to allow its differentiation
+template <typename T> T staticKuboToyabe(const T &A, const T &G, double x) {
+  using std::exp;
+  using std::pow;
+  return A * (exp(-pow(G * x, 2) / 2) * (1 - pow(G * x, 2)) * 2.0 / 3 +
+              1.0 / 3);
+}
+} // namespace
+
 DECLARE_FUNCTION(StaticKuboToyabe)
 
 void StaticKuboToyabe::init() {
@@ -34,9 +46,21 @@ void StaticKuboToyabe::function1D(double *out, const double *xValues,
   const double G = getParameter("Delta");
 
   for (size_t i = 0; i < nData; i++) {
-    out[i] = A * (exp(-pow(G * xValues[i], 2) / 2) *
-                      (1 - pow(G * xValues[i], 2)) * 2.0 / 3 +
-                  1.0 / 3);
+    out[i] = staticKuboToyabe(A, G, xValues[i]);
+  }
+}
+
+void StaticKuboToyabe::functionDeriv1D(Jacobian *out, const double *xValues,
+                                       const size_t nData) {
+  using Dual = DualNumber<2>;
+  const auto A = Dual::variable(getParameter("A"), 0);
+  const auto G = Dual::variable(getParameter("Delta"), 1);
+
+  for (size_t i = 0; i < nData; i++) {
+    const auto y = staticKuboToyabe(A, G, xValues[i]);
+    for (size_t j = 0; j < 2; j++) {
+      out->set(i, j, y.derivative(j));
+    }
   }
 }
 
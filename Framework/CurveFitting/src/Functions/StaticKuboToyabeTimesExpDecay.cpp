@@ -5,7 +5,9 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidCurveFitting/Functions/StaticKuboToyabeTimesExpDecay.h"
+#include "MantidAPI/DualNumber.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/Jacobian.h"
 #include <cmath>
 
 namespace Mantid {
@@ -18,6 +20,19 @@ using namespace Kernel;
 
 using namespace API;
 
+namespace {
+/// The function value at time x, templated to allow its differentiation
+template <typename T>
+T staticKuboToyabeTimesExpDecay(const T &A, const T &D, const T &L, double x) {
+  using std::exp;
+  using std::pow;
+  const double C1 = 2.0 / 3;
+  const double C2 = 1.0 / 3;
+  const T DXSquared = pow(D * x, 2);
+  return A * (exp(-DXSquared / 2) * (1 - DXSquared) * C1 + C2) * exp(-L * x);
+}
+} // namespace
+
 DECLARE_FUNCTION(StaticKuboToyabeTimesExpDecay)
 
 void StaticKuboToyabeTimesExpDecay::init() {
@@ -33,14 +48,24 @@ void StaticKuboToyabeTimesExpDecay::function1D(double *out,
   const double D = getParameter("Delta");
   const double L = getParameter("Lambda");
 
-  const double C1 = 2.0 / 3;
-  const double C2 = 1.0 / 3;
+  for (size_t i = 0; i < nData; i++) {
+    out[i] = staticKuboToyabeTimesExpDecay(A, D, L, xValues[i]);
+  }
+}
+
+void StaticKuboToyabeTimesExpDecay::functionDeriv1D(Jacobian *out,
+                                                    const double *xValues,
+                                                    const size_t nData) {
+  using Dual = DualNumber<3>;
+  const auto A = Dual::variable(getParameter("A"), 0);
+  const auto D = Dual::variable(getParameter("Delta"), 1);
+  const auto L = Dual::variable(getParameter("Lambda"), 2);
 
   for (size_t i = 0; i < nData; i++) {
-    double x = xValues[i];
-    double DXSquared = pow(D * x, 2);
-    out[i] =
-        A * (exp(-DXSquared / 2) * (1 - DXSquared) * C1 + C2) * exp(-L * x);
+    const auto y = staticKuboToyabeTimesExpDecay(A, D, L, xValues[i]);
+    for (size_t j = 0; j < 3; j++) {
+      out->set(i, j, y.derivative(j));
+    }
   }
 }
 
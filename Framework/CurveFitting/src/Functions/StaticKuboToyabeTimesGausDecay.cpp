@@ -5,7 +5,9 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidCurveFitting/Functions/StaticKuboToyabeTimesGausDecay.h"
+#include "MantidAPI/DualNumber.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/Jacobian.h"
 #include <cmath>
 
 namespace Mantid {
@@ -18,6 +20,22 @@ using namespace Kernel;
 
 using namespace API;
 
+namespace {
+/// The function value at time x, templated to allow its differentiation
+template <typename T>
+T staticKuboToyabeTimesGausDecay(const T &A, const T &D, const T &S,
+                                 double x) {
+  using std::exp;
+  using std::pow;
+  const double C1 = 2.0 / 3;
+  const double C2 = 1.0 / 3;
+  const double x2 = pow(x, 2);
+  const T D2 = pow(D, 2);
+  const T S2 = pow(S, 2);
+  return A * (exp(-(x2 * D2) / 2) * (1 - x2 * D2) * C1 + C2) * exp(-S2 * x2);
+}
+} // namespace
+
 DECLARE_FUNCTION(StaticKuboToyabeTimesGausDecay)
 
 void StaticKuboToyabeTimesGausDecay::init() {
@@ -33,20 +51,27 @@ void StaticKuboToyabeTimesGausDecay::function1D(double *out,
   const double D = getParameter("Delta");
   const double S = getParameter("Sigma");
 
-  // Precalculate squares
-  const double D2 = pow(D, 2);
-  const double S2 = pow(S, 2);
+  for (size_t i = 0; i < nData; i++) {
+    out[i] = staticKuboToyabeTimesGausDecay(A, D, S, xValues[i]);
+  }
+}
 
-  // Precalculate constants
-  const double C1 = 2.0 / 3;
-  const double C2 = 1.0 / 3;
+void StaticKuboToyabeTimesGausDecay::functionDeriv1D(Jacobian *out,
+                                                     const double *xValues,
+                                                     const size_t nData) {
+  using Dual = DualNumber<3>;
+  const auto A = Dual::variable(getParameter("A"), 0);
+  const auto D = Dual::variable(getParameter("Delta"), 1);
+  const auto S = Dual::variable(getParameter("Sigma"), 2);
 
   for (size_t i = 0; i < nData; i++) {
-    double x2 = pow(xValues[i], 2);
-    out[i] =
-        A * (exp(-(x2 * D2) / 2) * (1 - x2 * D2) * C1 + C2) * exp(-S2 * x2);
+    const auto y = staticKuboToyabeTimesGausDecay(A, D, S, xValues[i]);
+    for (size_t j = 0; j < 3; j++) {
+      out->set(i, j, y.derivative(j));
+    }
   }
 }
+
 } // namespace Functions
 } // namespace CurveFitting
 } // namespace Mantid
@@ -5,7 +5,9 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidCurveFitting/Functions/StaticKuboToyabeTimesStretchExp.h"
+#include "MantidAPI/DualNumber.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/Jacobian.h"
 #include <cmath>
 
 namespace Mantid {
@@ -18,6 +20,21 @@ using namespace Kernel;
 
 using namespace API;
 
+namespace {
+/// The function value at time x, templated to allow its differentiation
+template <typename T>
+T staticKuboToyabeTimesStretchExp(const T &A, const T &D, const T &L,
+                                  const T &B, double x) {
+  using std::exp;
+  using std::pow;
+  const double C1 = 2.0 / 3;
+  const double C2 = 1.0 / 3;
+  const T DXSquared = pow(D * x, 2);
+  const T stretchExp = exp(-pow(L * x, B));
+  return A * (exp(-DXSquared / 2) * (1 - DXSquared) * C1 + C2) * stretchExp;
+}
+} // namespace
+
 DECLARE_FUNCTION(StaticKuboToyabeTimesStretchExp)
 
 void StaticKuboToyabeTimesStretchExp::init() {
@@ -35,14 +52,25 @@ void StaticKuboToyabeTimesStretchExp::function1D(double *out,
   const double L = getParameter("Lambda");
   const double B = getParameter("Beta");
 
-  const double C1 = 2.0 / 3;
-  const double C2 = 1.0 / 3;
+  for (size_t i = 0; i < nData; i++) {
+    out[i] = staticKuboToyabeTimesStretchExp(A, D, L, B, xValues[i]);
+  }
+}
+
+void StaticKuboToyabeTimesStretchExp::functionDeriv1D(Jacobian *out,
+                                                      const double *xValues,
+                                                      const size_t nData) {
+  using Dual = DualNumber<4>;
+  const auto A = Dual::variable(getParameter("A"), 0);
+  const auto D = Dual::variable(getParameter("Delta"), 1);
+  const auto L = Dual::variable(getParameter("Lambda"), 2);
+  const auto B = Dual::variable(getParameter("Beta"), 3);
 
   for (size_t i = 0; i < nData; i++) {
-    double x = xValues[i];
-    double DXSquared = pow(D * x, 2);
-    double stretchExp = exp(-pow(L * x, B));
-    out[i] = A * (exp(-DXSquared / 2) * (1 - DXSquared) * C1 + C2) * stretchExp;
+    const auto y = staticKuboToyabeTimesStretchExp(A, D, L, B, xValues[i]);
+    for (size_t j = 0; j < 4; j++) {
+      out->set(i, j, y.derivative(j));
+    }
   }
 }
 
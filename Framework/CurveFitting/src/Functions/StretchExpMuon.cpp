@@ -8,7 +8,9 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/StretchExpMuon.h"
+#include "MantidAPI/DualNumber.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/Jacobian.h"
 #include <cmath>
 
 namespace Mantid {
@@ -21,6 +23,16 @@ using namespace Kernel;
 
 using namespace API;
 
+namespace {
+/// The function value at time x, templated to allow its differentiation
+template <typename T>
+T stretchExpMuon(const T &A, const T &G, const T &b, double x) {
+  using std::exp;
+  using std::pow;
+  return A * exp(-pow(G * x, b));
+}
+} // namespace
+
 DECLARE_FUNCTION(StretchExpMuon)
 
 void StretchExpMuon::init() {
@@ -37,7 +49,22 @@ void StretchExpMuon::function1D(double *out, const double *xValues,
   const double b = getParameter("Beta");
 
   for (size_t i = 0; i < nData; i++) {
-    out[i] = A * exp(-pow(G * xValues[i], b));
+    out[i] = stretchExpMuon(A, G, b, xValues[i]);
+  }
+}
+
+void StretchExpMuon::functionDeriv1D(Jacobian *out, const double *xValues,
+                                     const size_t nData) {
+  using Dual = DualNumber<3>;
+  const auto A = Dual::variable(getParameter("A"), 0);
+  const auto G = Dual::variable(getParameter("Lambda"), 1);
+  const auto b = Dual::variable(getParameter("Beta"), 2);
+
+  for (size_t i = 0; i < nData; i++) {
+    const auto y = stretchExpMuon(A, G, b, xValues[i]);
+    for (size_t j = 0; j < 3; j++) {
+      out->set(i, j, y.derivative(j));
+    }
   }
 }
 
@@ -167,6 +167,44 @@ public:
     WorkspaceCreationHelper::removeWS("PlotPeakResult");
   }
 
+  void testWorkspaceGroupIndividual() {
+    createData();
+
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("Input", "PlotPeakGroup");
+    alg.setPropertyValue("OutputWorkspace", "PlotPeakResult");
+    alg.setPropertyValue("WorkspaceIndex", "1");
+    alg.setPropertyValue("LogValue", "var");
+    alg.setPropertyValue("FitType", "Individual");
+    alg.setPropertyValue("Function", "name=LinearBackground,A0=1,A1=0.3;name="
+                                     "Gaussian,PeakCentre=5,Height=2,Sigma=0."
+                                     "1");
+    alg.execute();
+    TS_ASSERT(alg.isExecuted());
+
+    TWS_type result =
+        WorkspaceCreationHelper::getWS<TableWorkspace>("PlotPeakResult");
+    TS_ASSERT_EQUALS(result->rowCount(), 3);
+    TS_ASSERT_EQUALS(result->columnCount(), 12);
+
+    // Rows follow the order of the inputs
+    TS_ASSERT_DELTA(result->Double(0, 0), 1, 1e-10);
+    TS_ASSERT_DELTA(result->Double(0, 1), 1, 1e-6);
+    TS_ASSERT_DELTA(result->Double(0, 7), 5, 1e-6);
+
+    TS_ASSERT_DELTA(result->Double(1, 0), 1.3, 1e-10);
+    TS_ASSERT_DELTA(result->Double(1, 1), 1.1, 1e-6);
+    TS_ASSERT_DELTA(result->Double(1, 7), 5.03, 1e-6);
+
+    TS_ASSERT_DELTA(result->Double(2, 0), 1.6, 1e-10);
+    TS_ASSERT_DELTA(result->Double(2, 1), 1.2, 1e-6);
+    TS_ASSERT_DELTA(result->Double(2, 7), 5.06, 1e-6);
+
+    deleteData();
+    WorkspaceCreationHelper::removeWS("PlotPeakResult");
+  }
+
   void testWorkspaceList() {
     createData();
 
@@ -169,6 +169,38 @@ public:
     TS_ASSERT_DELTA(g.get(1), 0.9, 1e-10);
   }
 
+  void test_hessian_of_active_parameters() {
+    std::vector<double> x{0., 1., 2.}, y{2., 3., 4.};
+    API::FunctionDomain1D_sptr domain(new API::FunctionDomain1DVector(x));
+    API::FunctionValues_sptr values(new API::FunctionValues(*domain));
+    values->setFitData(y);
+    values->setFitWeights(1.0);
+
+    std::shared_ptr<UserFunction> fun = std::make_shared<UserFunction>();
+    fun->setAttributeValue("Formula", "a*x+b");
+    fun->setParameter("a", 1.1);
+    fun->setParameter("b", 2.2);
+
+    std::shared_ptr<CostFuncLeastSquares> costFun =
+        std::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(fun, domain, values);
+
+    // H == J^T * J with J == [x, 1]
+    TS_ASSERT_DELTA(costFun->valDerivHessian(), 0.145, 1e-10);
+    const GSLMatrix &H = costFun->getHessian();
+    TS_ASSERT_DELTA(H.get(0, 0), 5.0, 1e-10);
+    TS_ASSERT_DELTA(H.get(0, 1), 3.0, 1e-10);
+    TS_ASSERT_DELTA(H.get(1, 0), 3.0, 1e-10);
+    TS_ASSERT_DELTA(H.get(1, 1), 3.0, 1e-10);
+
+    fun->fix(0);
+    costFun->setFittingFunction(fun, domain, values);
+    TS_ASSERT_EQUALS(costFun->nParams(), 1);
+    TS_ASSERT_DELTA(costFun->valDerivHessian(), 0.145, 1e-10);
+    TS_ASSERT_DELTA(costFun->getDeriv().get(0), 0.9, 1e-10);
+    TS_ASSERT_DELTA(costFun->getHessian().get(0, 0), 3.0, 1e-10);
+  }
+
   void test_linear_correction_is_good_approximation() {
     const double a = 1.0;
     const double b = 2.0;
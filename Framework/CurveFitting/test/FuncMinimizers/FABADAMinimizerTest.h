@@ -167,6 +167,42 @@ public:
   }
   static void destroySuite(FABADAMinimizerTest *suite) { delete suite; }
 
+  void test_repeated_fits_are_reproducible() {
+    auto ws2 = createExpDecayWorkspace();
+
+    auto runFit = [&ws2](const std::string &seed) {
+      Mantid::API::IFunction_sptr fun(new ExpDecay);
+      fun->setParameter("Height", 8.);
+      fun->setParameter("Lifetime", 1.0);
+
+      Fit fit;
+      fit.initialize();
+      fit.setChild(true);
+      fit.setProperty("Function", fun);
+      fit.setProperty("InputWorkspace", ws2);
+      fit.setProperty("WorkspaceIndex", 0);
+      fit.setProperty("MaxIterations", 100000);
+      fit.setProperty("Minimizer", "FABADA,ChainLength=2000,StepsBetweenValues="
+                                   "10,ConvergenceCriteria=0.1,PDF=0,Seed=" +
+                                       seed);
+      fit.execute();
+      return std::make_pair(fun->getParameter("Height"),
+                            fun->getParameter("Lifetime"));
+    };
+
+    // each fit owns its random number generator, so an earlier fit does not
+    // change the chain of a later one
+    const auto first = runFit("1");
+    const auto second = runFit("1");
+    TS_ASSERT_EQUALS(first.first, second.first);
+    TS_ASSERT_EQUALS(first.second, second.second);
+
+    // a different seed gives a different chain
+    const auto other = runFit("2");
+    TS_ASSERT_DIFFERS(first.first, other.first);
+    TS_ASSERT_DIFFERS(first.second, other.second);
+  }
+
   void test_expDecay() {
     auto ws2 = createExpDecayWorkspace();
 
@@ -356,6 +356,44 @@ public:
     }
   }
 
+  void testConvolutionOnDomainsOfDifferentSizes() {
+    Convolution conv;
+
+    double pi = acos(0.) * 2;
+    double h1 = 3, s1 = pi / 2;
+    auto res = std::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("c", 0.);
+    res->setParameter("h", h1);
+    res->setParameter("s", s1);
+    conv.addFunction(res);
+
+    double c2 = 7.5, h2 = 10., s2 = pi / 3;
+    auto fun = std::make_shared<ConvolutionTest_Gauss>();
+    fun->setParameter("c", c2);
+    fun->setParameter("h", h2);
+    fun->setParameter("s", s2);
+    conv.addFunction(fun);
+
+    double sp = s1 * s2 / (s1 + s2);
+    double hp = h1 * h2 * sqrt(pi / (s1 + s2));
+
+    // the cached resolution and FFT workspace must follow the domain size
+    for (const size_t n : {116, 150, 116}) {
+      std::vector<double> x(n);
+      const double dx = 15. / static_cast<double>(n);
+      for (size_t i = 0; i < n; i++) {
+        x[i] = static_cast<double>(i) * dx;
+      }
+      FunctionDomain1DView xView(x.data(), n);
+      FunctionValues out(xView);
+      conv.function(xView, out);
+      for (size_t i = 0; i < n; i++) {
+        double xi = x[i] - c2;
+        TS_ASSERT_DELTA(out.getCalculated(i), hp * exp(-sp * xi * xi), 1e-8);
+      }
+    }
+  }
+
   /*
    * Convolve a Gausian (resolution) with a Delta-Dirac
    */
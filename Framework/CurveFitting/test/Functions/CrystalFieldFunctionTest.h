@@ -711,6 +711,30 @@ public:
     TS_ASSERT_EQUALS(cf.getParameter("ion1.B20"), 2.0);
   }
 
+  void test_setting_field_parameter_to_same_value_keeps_target() {
+    CrystalFieldFunction cf;
+    cf.setAttributeValue("Ions", "Ce");
+    cf.setAttributeValue("Symmetries", "C2v");
+    cf.setAttributeValue("Temperatures", std::vector<double>({44}));
+    cf.setAttributeValue("FWHMs", std::vector<double>({1}));
+    cf.setParameter("B20", 0.37737);
+    cf.setParameter("B22", 3.9770);
+    cf.setParameter("B40", -0.031787);
+    cf.setParameter("B42", -0.11611);
+    cf.setParameter("B44", -0.12544);
+    const double centre = cf.getParameter("pk1.PeakCentre");
+
+    // An edited peak shows whether the target has been rebuilt
+    cf.setParameter("pk1.PeakCentre", 10.0);
+    cf.setParameter("B20", cf.getParameter("B20"));
+    cf.setParameter("IntensityScaling", cf.getParameter("IntensityScaling"));
+    TS_ASSERT_EQUALS(cf.getParameter("pk1.PeakCentre"), 10.0);
+
+    cf.setParameter("B20", 0.38);
+    TS_ASSERT_DIFFERS(cf.getParameter("pk1.PeakCentre"), 10.0);
+    TS_ASSERT_DELTA(cf.getParameter("pk1.PeakCentre"), centre, 1.0);
+  }
+
 private:
   MatrixWorkspace_sptr makeDataSS() {
     auto ws = create2DWorkspaceBinned(1, 100, 0.0, 0.5);
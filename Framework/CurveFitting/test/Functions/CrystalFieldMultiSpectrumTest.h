@@ -22,6 +22,7 @@
 #include "MantidCurveFitting/Algorithms/Fit.h"
 #include "MantidCurveFitting/Constraints/BoundaryConstraint.h"
 #include "MantidCurveFitting/Functions/CrystalFieldMultiSpectrum.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -517,6 +518,73 @@ public:
     }
   }
 
+  void test_setting_field_parameter_to_same_value_keeps_spectrum() {
+    auto fun = FunctionFactory::Instance().createInitialized(
+        "name=CrystalFieldMultiSpectrum,Ion=Ce,Temperatures=(44, 50),"
+        "ToleranceIntensity=0.001,FWHMs=(1.5, 1.5),B20=0.37737,B22=3.9770,"
+        "B40=-0.031787,B42=-0.11611,B44=-0.12544");
+    const double centre = fun->getParameter("f0.f2.PeakCentre");
+    TS_ASSERT_DELTA(centre, 29.3261, 1e-3);
+
+    // An edited peak shows whether the spectrum has been recalculated
+    fun->setParameter("f0.f2.PeakCentre", 10.0);
+    fun->setParameter("B20", fun->getParameter("B20"));
+    TS_ASSERT_EQUALS(fun->getParameter("f0.f2.PeakCentre"), 10.0);
+
+    fun->setParameter("B20", 0.38);
+    TS_ASSERT_DIFFERS(fun->getParameter("f0.f2.PeakCentre"), 10.0);
+    TS_ASSERT_DELTA(fun->getParameter("f0.f2.PeakCentre"), centre, 1.0);
+  }
+
+  void test_cached_eigensystems_give_same_values_and_derivatives() {
+    const std::string funDef =
+        "name=CrystalFieldMultiSpectrum,Ion=Ce,Temperatures=(44, 50),"
+        "ToleranceIntensity=0.001,FWHMs=(1.5, 2.0),B20=0.37737,B22=3.9770,"
+        "B40=-0.031787,B42=-0.11611,B44=-0.12544";
+    auto fun = FunctionFactory::Instance().createInitialized(funDef);
+    JointDomain domain;
+    for (size_t i = 0; i < fun->getNumberDomains(); ++i) {
+      domain.addDomain(
+          FunctionDomain_sptr(new FunctionDomain1DVector(0.0, 55.0, 100)));
+    }
+
+    // Compare with a new function, which has no cached eigensystems
+    auto checkAgainstNewFunction = [&]() {
+      auto expectedFun = FunctionFactory::Instance().createInitialized(funDef);
+      const auto nParams = fun->nParams();
+      TS_ASSERT_EQUALS(expectedFun->nParams(), nParams);
+      for (size_t i = 0; i < nParams; ++i) {
+        expectedFun->setParameter(i, fun->getParameter(i));
+      }
+      FunctionValues values(domain);
+      FunctionValues expectedValues(domain);
+      fun->function(domain, values);
+      expectedFun->function(domain, expectedValues);
+      CurveFitting::Jacobian jacobian(domain.size(), nParams);
+      CurveFitting::Jacobian expectedJacobian(domain.size(), nParams);
+      fun->functionDeriv(domain, jacobian);
+      expectedFun->functionDeriv(domain, expectedJacobian);
+      for (size_t iY = 0; iY < domain.size(); ++iY) {
+        TS_ASSERT_DELTA(values.getCalculated(iY),
+                        expectedValues.getCalculated(iY), 1e-10);
+        for (size_t iP = 0; iP < nParams; ++iP) {
+          TS_ASSERT_DELTA(jacobian.get(iY, iP), expectedJacobian.get(iY, iP),
+                          1e-10);
+        }
+      }
+    };
+
+    checkAgainstNewFunction();
+    fun->setParameter("B20", 0.38);
+    checkAgainstNewFunction();
+    // Back to an eigensystem that is still cached
+    fun->setParameter("B20", 0.37737);
+    checkAgainstNewFunction();
+    // A peak parameter doesn't change the eigensystem
+    fun->setParameter("f1.f2.FWHM", 2.5);
+    checkAgainstNewFunction();
+  }
+
 private:
   Workspace_sptr createWorkspace() {
     auto ws = WorkspaceFactory::Instance().create("Workspace2D", 1, 100, 100);
@@ -8,7 +8,10 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/FunctionValues.h"
 #include "MantidCurveFitting/Functions/StaticKuboToyabeTimesExpDecay.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 using Mantid::CurveFitting::Functions::StaticKuboToyabeTimesExpDecay;
 
@@ -68,5 +71,35 @@ public:
     TS_ASSERT_DELTA(y[9], 0.0234, 1e-4);
   }
 
+  void test_derivatives_match_numerical_derivatives() {
+    StaticKuboToyabeTimesExpDecay fn;
+    fn.initialize();
+    fn.setParameter("A", 0.45);
+    fn.setParameter("Delta", 1.05);
+    fn.setParameter("Lambda", 0.23);
+
+    Mantid::API::FunctionDomain1DVector x(0, 2, 10);
+    Mantid::CurveFitting::Jacobian jacobian(x.size(), fn.nParams());
+    fn.functionDeriv(x, jacobian);
+
+    // Central differences are accurate to ~1e-10 here, well below the
+    // difference between any two columns of the Jacobian
+    const double step = 1e-5;
+    for (size_t j = 0; j < fn.nParams(); ++j) {
+      const double value = fn.getParameter(j);
+      Mantid::API::FunctionValues yPlus(x);
+      Mantid::API::FunctionValues yMinus(x);
+      fn.setParameter(j, value + step);
+      fn.function(x, yPlus);
+      fn.setParameter(j, value - step);
+      fn.function(x, yMinus);
+      fn.setParameter(j, value);
+      for (size_t i = 0; i < x.size(); ++i) {
+        TS_ASSERT_DELTA(jacobian.get(i, j),
+                        (yPlus[i] - yMinus[i]) / (2 * step), 1e-8);
+      }
+    }
+  }
+
   StaticKuboToyabeTimesExpDecay fn;
 };
@@ -8,8 +8,10 @@
 
 #include <array>
 #include <cmath>
+#include <complex>
 #include <cxxtest/TestSuite.h>
 
+#include "MantidAPI/IPowderDiffPeakFunction.h"
 #include "MantidCurveFitting/Functions/ThermalNeutronBk2BkExpConvPVoigt.h"
 
 using namespace Mantid;
@@ -203,6 +205,25 @@ public:
     return;
   }
 
+  /** Test E1() away from the origin, where it is given by a continued
+   * fraction. Reference values are from summing its first 120 terms.
+   */
+  void test_E1_continued_fraction() {
+    using Mantid::API::E1;
+    const std::array<std::complex<double>, 3> z{
+        {{15.0, 2.0}, {30.0, -5.0}, {-25.0, 3.0}}};
+    const std::array<std::complex<double>, 3> expected{
+        {{-1.068355669713797e-08, -1.700656370698563e-08},
+         {1.340114035909590e-15, -2.758563563418699e-15},
+         {2.773438723248370e+09, 7.422521575429294e+08}}};
+    for (size_t i = 0; i < z.size(); ++i) {
+      const auto e1 = E1(z[i]);
+      const double tolerance = 1.0e-13 * std::abs(expected[i]);
+      TS_ASSERT_DELTA(e1.real(), expected[i].real(), tolerance);
+      TS_ASSERT_DELTA(e1.imag(), expected[i].imag(), tolerance);
+    }
+  }
+
   /** Test on calcualte peak parameters including Gamma (i.e., E1())
    * Parameter and data is from PG3_11485, Bank 1, (200) @ TOF = 46963
    */
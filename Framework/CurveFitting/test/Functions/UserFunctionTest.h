@@ -83,4 +83,29 @@ public:
     TS_ASSERT(categories.size() == 1);
     TS_ASSERT(categories[0] == "General");
   }
+
+  void test_evaluation_of_domains_of_different_sizes() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*x^2+b"));
+    fun.setParameter("a", 1.5);
+    fun.setParameter("b", -0.5);
+
+    for (const size_t nData : {5, 1, 12}) {
+      std::vector<double> x(nData), y(nData);
+      for (size_t i = 0; i < nData; i++) {
+        x[i] = 0.3 * static_cast<double>(i);
+      }
+      fun.function1D(y.data(), x.data(), nData);
+      for (size_t i = 0; i < nData; i++) {
+        TS_ASSERT_DELTA(y[i], 1.5 * x[i] * x[i] - 0.5, 1e-12);
+      }
+    }
+
+    // Parameter changes are picked up by the next evaluation
+    fun.setParameter("b", 2.0);
+    std::vector<double> x{1.0, 2.0}, y(2);
+    fun.function1D(y.data(), x.data(), 2);
+    TS_ASSERT_DELTA(y[0], 3.5, 1e-12);
+    TS_ASSERT_DELTA(y[1], 8.0, 1e-12);
+  }
 };
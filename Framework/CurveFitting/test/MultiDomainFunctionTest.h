@@ -70,4 +70,44 @@ public:
     TS_ASSERT_THROWS_NOTHING(
         multi = Mantid::TestHelpers::makeMultiDomainFunction3());
   }
+
+  void test_least_squares_derivatives_are_added_per_domain() {
+    auto domain = Mantid::TestHelpers::makeMultiDomainDomain3();
+    auto values = std::make_shared<FunctionValues>(*domain);
+    for (size_t i = 0; i < values->size(); ++i) {
+      values->setFitData(i, 1.0 + 0.1 * static_cast<double>(i));
+    }
+    values->setFitWeights(1);
+
+    auto multi = Mantid::TestHelpers::makeMultiDomainFunction3();
+    for (size_t i = 0; i < multi->nParams(); ++i) {
+      multi->setParameter(i, 0.5 * static_cast<double>(i + 1));
+    }
+    multi->fix(3);
+
+    auto costFun = std::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(multi, domain, values);
+    const double value = costFun->valDerivHessian();
+    const GSLVector der = costFun->getDeriv();
+    const GSLMatrix hessian = costFun->getHessian();
+    TS_ASSERT_EQUALS(der.size(), 5);
+
+    // Numerical derivatives go through the Jacobian of the joint domain.
+    // The member functions are linear in their parameters, so the two
+    // must agree.
+    multi->setAttributeValue("NumDeriv", true);
+    auto denseCostFun = std::make_shared<CostFuncLeastSquares>();
+    denseCostFun->setFittingFunction(multi, domain, values);
+    TS_ASSERT_DELTA(denseCostFun->valDerivHessian(), value, 1e-10);
+    const GSLVector &denseDer = denseCostFun->getDeriv();
+    const GSLMatrix &denseHessian = denseCostFun->getHessian();
+    for (size_t i = 0; i < der.size(); ++i) {
+      TS_ASSERT_DELTA(der.get(i), denseDer.get(i), 1e-5);
+      for (size_t j = 0; j < der.size(); ++j) {
+        TS_ASSERT_DELTA(hessian.get(i, j), denseHessian.get(i, j), 1e-5);
+      }
+    }
+    // The second and third functions share only the first domain
+    TS_ASSERT_DIFFERS(hessian.get(2, 3), 0.0);
+  }
 };
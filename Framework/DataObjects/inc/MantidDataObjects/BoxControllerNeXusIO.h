@@ -61,6 +61,10 @@ public:
   int64_t getNDataColums() const { return m_BlockSize[1]; }
   // get pointer to the Nexus file --> compatribility testing only.
   ::NeXus::File *getFile() { return m_File.get(); }
+  /// Request compressed event data. Only affects newly created event datasets
+  void setCompression(bool compress) { m_compressData = compress; }
+  ///@return true if newly created event datasets are compressed
+  bool getCompression() const { return m_compressData; }
 
 private:
   /// Default size of the events block which can be written in the NeXus array
@@ -80,6 +84,9 @@ private:
   size_t m_dataChunk;
   /// shared pointer to the box controller, which is repsoponsible for this IO
   API::BoxController *const m_bc;
+  /// if true, the event dataset is created compressed with chunks no longer
+  /// than the split threshold
+  bool m_compressData;
   //------
   /// the start of the current data block to read from. It related to current
   /// physical representation of the data in NeXus file
@@ -14,6 +14,7 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
 
+#include <algorithm>
 #include <string>
 
 namespace Mantid {
@@ -32,9 +33,9 @@ std::string BoxControllerNeXusIO::g_DBDataName("free_space_blocks");
 */
 BoxControllerNeXusIO::BoxControllerNeXusIO(API::BoxController *const bc)
     : m_File(nullptr), m_ReadOnly(true), m_dataChunk(DATA_CHUNK), m_bc(bc),
-      m_BlockStart(2, 0), m_BlockSize(2, 0), m_CoordSize(sizeof(coord_t)),
-      m_EventType(FatEvent), m_EventsVersion("1.0"),
-      m_ReadConversion(noConversion) {
+      m_compressData(false), m_BlockStart(2, 0), m_BlockSize(2, 0),
+      m_CoordSize(sizeof(coord_t)), m_EventType(FatEvent),
+      m_EventsVersion("1.0"), m_ReadConversion(noConversion) {
   m_BlockSize[1] = 4 + m_bc->getNDims();
 
   for (auto &EventHeader : EventHeaders) {
@@ -222,14 +223,25 @@ void BoxControllerNeXusIO::prepareNxSToWrite_CurVersion() {
     // Now the chunk size.
     std::vector<int64_t> chunk(m_BlockSize);
     chunk[0] = static_cast<int64_t>(m_dataChunk);
+    ::NeXus::NXcompression compression = ::NeXus::NONE;
+    if (m_compressData) {
+      // A compressed chunk has to be decompressed as a whole, so the chunk
+      // length is capped at the split threshold, the most events a leaf box
+      // normally holds. Chunks are not aligned to box boundaries, so a box
+      // read decompresses at most a couple of small chunks.
+      compression = ::NeXus::LZW;
+      const auto boxSize = static_cast<int64_t>(m_bc->getSplitThreshold());
+      if (boxSize > 0)
+        chunk[0] = std::min(chunk[0], boxSize);
+    }
 
     // Make and open the data
     if (m_CoordSize == 4)
       m_File->makeCompData("event_data", ::NeXus::FLOAT32, m_BlockSize,
-                           ::NeXus::NONE, chunk, true);
+                           compression, chunk, true);
     else
       m_File->makeCompData("event_data", ::NeXus::FLOAT64, m_BlockSize,
-                           ::NeXus::NONE, chunk, true);
+                           compression, chunk, true);
 
     // A little bit of description for humans to read later
     m_File->putAttr("description", m_EventsTypeHeaders[m_EventType]);
@@ -13,6 +13,7 @@
 #include "MantidGeometry/MDGeometry/MDDimensionExtents.h"
 #include "MantidGeometry/MDGeometry/MDGeometryXMLBuilder.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/VMD.h"
 #include "MantidKernel/WarningSuppressions.h"
@@ -27,6 +28,11 @@ using namespace Mantid::Kernel;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
 
+namespace {
+/// Element-wise operations on fewer bins than this are not worth threading
+constexpr size_t PARALLEL_MIN_LENGTH = 100000;
+} // namespace
+
 namespace Mantid {
 namespace DataObjects {
 //----------------------------------------------------------------------------------------------
@@ -765,7 +771,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator+=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "add");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] += b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
@@ -781,7 +788,8 @@ void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] += signal;
     m_errorsSquared[i] += errorSquared;
   }
@@ -804,7 +812,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator-=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "subtract");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] -= b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
@@ -820,7 +829,8 @@ void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] -= signal;
     m_errorsSquared[i] += errorSquared;
   }
@@ -852,7 +862,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator*=(const MDHistoWorkspace &b_ws) {
  * */
 void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "multiply");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -883,7 +894,8 @@ void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
 
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -921,7 +933,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator/=(const MDHistoWorkspace &b_ws) {
  **/
 void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "divide");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -952,7 +965,8 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
   signal_t db2_relative = db2 / (b * b);
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -971,7 +985,8 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
  * \f$ df^2 = a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -991,7 +1006,8 @@ void MDHistoWorkspace::log(double filler) {
  * \f$ df^2 = (ln(10)^-2) * a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log10(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -1011,7 +1027,8 @@ void MDHistoWorkspace::log10(double filler) {
  * \f$ df^2 = f^2 * da^2 \f$
  */
 void MDHistoWorkspace::exp() {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t f = std::exp(m_signals[i]);
     signal_t da2 = m_errorsSquared[i];
     m_signals[i] = f;
@@ -1028,7 +1045,8 @@ void MDHistoWorkspace::exp() {
  */
 void MDHistoWorkspace::power(double exponent) {
   double exponent_squared = exponent * exponent;
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t a = m_signals[i];
     signal_t f = std::pow(a, exponent);
     signal_t da2 = m_errorsSquared[i];
@@ -1053,7 +1071,8 @@ void MDHistoWorkspace::power(double exponent) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "&= (and)");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) &&
                     (b.m_signals[i] != 0 && !b.m_masks[i]))
                        ? 1.0
@@ -1073,7 +1092,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "|= (or)");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ||
                     (b.m_signals[i] != 0 && !b.m_masks[i]))
                        ? 1.0
@@ -1093,7 +1113,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "^= (xor)");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ^
                     (b.m_signals[i] != 0 && !b.m_masks[i]))
                        ? 1.0
@@ -1110,7 +1131,8 @@ MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
  * 0.0 is "false", all other values are "true". All errors are set to 0.
  */
 void MDHistoWorkspace::operatorNot() {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] == 0.0 || m_masks[i]);
     m_errorsSquared[i] = 0;
   }
@@ -1126,7 +1148,8 @@ void MDHistoWorkspace::operatorNot() {
  */
 void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "lessThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] < b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1141,7 +1164,8 @@ void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::lessThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] < signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1157,7 +1181,8 @@ void MDHistoWorkspace::lessThan(const signal_t signal) {
  */
 void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "greaterThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] > b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1172,7 +1197,8 @@ void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::greaterThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     m_signals[i] = (m_signals[i] > signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1190,7 +1216,8 @@ void MDHistoWorkspace::greaterThan(const signal_t signal) {
 void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
                                const signal_t tolerance) {
   checkWorkspaceSize(b, "equalTo");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t diff = fabs(m_signals[i] - b.m_signals[i]);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
@@ -1208,7 +1235,8 @@ void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
  */
 void MDHistoWorkspace::equalTo(const signal_t signal,
                                const signal_t tolerance) {
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     signal_t diff = fabs(m_signals[i] - signal);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
@@ -1235,7 +1263,8 @@ void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask,
                                     const MDHistoWorkspace &values) {
   checkWorkspaceSize(mask, "setUsingMask");
   checkWorkspaceSize(values, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = values.m_signals[i];
       m_errorsSquared[i] = values.m_errorsSquared[i];
@@ -1265,7 +1294,8 @@ void MDHistoWorkspace::setUsingMask(const MDHistoWorkspace &mask,
                                     const signal_t error) {
   signal_t errorSquared = error * error;
   checkWorkspaceSize(mask, "setUsingMask");
-  for (size_t i = 0; i < m_length; ++i) {
+  PARALLEL_FOR_IF(m_length > PARALLEL_MIN_LENGTH)
+  for (int64_t i = 0; i < static_cast<int64_t>(m_length); ++i) {
     if (mask.m_signals[i] != 0.0) {
       m_signals[i] = signal;
       m_errorsSquared[i] = errorSquared;
@@ -233,6 +233,40 @@ public:
 
   void test_WriteFloatReadDouble() { this->WriteReadRead<float, double>(); }
 
+  void test_WriteReadCompressed() {
+    using Mantid::DataObjects::BoxControllerNeXusIO;
+
+    std::unique_ptr<BoxControllerNeXusIO> pSaver(createTestBoxController());
+    TS_ASSERT(!pSaver->getCompression());
+    pSaver->setCompression(true);
+    TS_ASSERT(pSaver->getCompression());
+    pSaver->setDataType(sizeof(float), "MDEvent");
+
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
+    std::string FullPathFile = pSaver->getFileName();
+
+    size_t nEvents = 5000;
+    size_t nColumns = pSaver->getNDataColums();
+    std::vector<float> toWrite(nColumns * nEvents);
+    for (size_t i = 0; i < toWrite.size(); i++)
+      toWrite[i] = static_cast<float>(i % 17);
+    TS_ASSERT_THROWS_NOTHING(pSaver->saveBlock(toWrite, 0));
+    TS_ASSERT_THROWS_NOTHING(pSaver->closeFile());
+
+    // compressed data are read back transparently
+    TS_ASSERT_THROWS_NOTHING(pSaver->openFile(FullPathFile, "r"));
+    std::vector<float> toRead;
+    TS_ASSERT_THROWS_NOTHING(pSaver->loadBlock(toRead, 1000, 10));
+    TS_ASSERT_EQUALS(toRead.size(), 10 * nColumns);
+    for (size_t i = 0; i < toRead.size(); i++)
+      TS_ASSERT_EQUALS(toRead[i], toWrite[1000 * nColumns + i]);
+    TS_ASSERT_THROWS_NOTHING(pSaver->closeFile());
+
+    pSaver.reset();
+    if (Poco::File(FullPathFile).exists())
+      Poco::File(FullPathFile).remove();
+  }
+
 private:
   /// Create a test box controller. Ownership is passed to the caller
   Mantid::DataObjects::BoxControllerNeXusIO *createTestBoxController() {
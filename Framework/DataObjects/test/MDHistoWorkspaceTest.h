@@ -881,6 +881,23 @@ public:
     checkWorkspace(a, 1.5, 1.5 * 1.5 * (.5 + 1. / 3.), 1.0);
   }
 
+  //--------------------------------------------------------------------------------------
+  void test_divide_ws_large_enough_to_run_in_parallel() {
+    MDHistoWorkspace_sptr a = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        3.0, 1, 250000, 10.0, 3.0 /*errorSquared*/);
+    MDHistoWorkspace_sptr b = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        2.0, 1, 250000, 10.0, 2.0 /*errorSquared*/);
+    *a /= *b;
+    const double expectedErrorSquared = 1.5 * 1.5 * (.5 + 1. / 3.);
+    size_t numWrong(0);
+    for (size_t i = 0; i < a->getNPoints(); i++) {
+      if (std::abs(a->getSignalAt(i) - 1.5) > 1e-5 ||
+          std::abs(a->getErrorAt(i) - std::sqrt(expectedErrorSquared)) > 1e-5)
+        ++numWrong;
+    }
+    TS_ASSERT_EQUALS(numWrong, 0);
+  }
+
   //--------------------------------------------------------------------------------------
   void test_exp() {
     MDHistoWorkspace_sptr a =
@@ -13,6 +13,7 @@
 #include <Poco/AutoPtr.h>
 #include <Poco/DOM/Document.h>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace Poco {
@@ -338,7 +339,7 @@ private:
    *  - instead of using the comparatively slow poco call getElementsByTagName()
    * (or getChildElement)
    */
-  std::vector<Poco::XML::Element *> m_hasParameterElement;
+  std::unordered_set<const Poco::XML::Element *> m_hasParameterElement;
   /// has m_hasParameterElement been set - used when public method
   /// setComponentLinks is used
   bool m_hasParameterElement_beenSet;
@@ -199,6 +199,12 @@ private:
   std::unique_ptr<CompGrp> procComp(std::unique_ptr<Rule>) const;
   int checkSurfaceValid(const Kernel::V3D &, const Kernel::V3D &) const;
 
+  /// Flatten the rule tree into m_flatRules
+  void flattenRules();
+  bool flattenRule(const Rule *rule);
+  /// Evaluate the flattened rule starting at the given node
+  bool isValidFlat(size_t index, const Kernel::V3D &point) const;
+
   /// Calculate bounding box using Rule system
   void calcBoundingBoxByRule();
 
@@ -217,6 +223,19 @@ private:
                                     const size_t seed) const;
   /// Top rule [ Geometric scope of object]
   std::unique_ptr<Rule> TopRule;
+  /// A node of the rule tree flattened in depth-first order
+  struct FlatRule {
+    enum class Type : uint8_t { Surface, Object, Value, And, Or, Not };
+    Type type;
+    /// Surface: sign of the surface; Value: the constant value
+    int sign;
+    /// Index one past the last node of the subtree rooted here
+    size_t end;
+    const Surface *surface;
+    const CSGObject *object;
+  };
+  /// Flattened copy of TopRule used by isValid(V3D). Empty if not built.
+  std::vector<FlatRule> m_flatRules;
   /// Object's bounding box
   BoundingBox m_boundingBox;
   // -- DEPRECATED --
@@ -13,7 +13,7 @@
 #include <boost/unordered_map.hpp>
 #include <deque>
 #include <list>
-#include <mutex>
+#include <shared_mutex>
 
 namespace Mantid {
 namespace Kernel {
@@ -61,8 +61,8 @@ private:
   mutable Track m_resultsTrack;
   /// Map of component id -> bounding box.
   mutable boost::unordered_map<IComponent *, BoundingBox> m_boxCache;
-  /// Mutex to lock box cache
-  mutable std::mutex m_mutex;
+  /// Mutex to lock box cache. Lookups share it, insertions are exclusive.
+  mutable std::shared_mutex m_mutex;
 };
 } // namespace Geometry
 } // namespace Mantid
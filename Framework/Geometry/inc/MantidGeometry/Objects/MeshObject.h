@@ -18,6 +18,7 @@
 #include "MantidKernel/Matrix.h"
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace Mantid {
 //----------------------------------------------------------------------
@@ -157,6 +158,13 @@ private:
       std::vector<Kernel::V3D> &intersectionPoints,
       std::vector<Mantid::Geometry::TrackDirection> &entryExitFlags) const;
 
+  /// Build the bounding volume hierarchy over the triangles
+  void buildBVH();
+  /// Get the triangles whose bounding volumes are hit by a ray
+  void getCandidateTriangles(const Kernel::V3D &start,
+                             const Kernel::V3D &direction,
+                             std::vector<uint32_t> &candidates) const;
+
   /// Get triangle
   bool getTriangle(const size_t index, Kernel::V3D &v1, Kernel::V3D &v2,
                    Kernel::V3D &v3) const;
@@ -189,6 +197,21 @@ private:
   std::vector<Kernel::V3D> m_vertices;
   /// material composition
   Kernel::Material m_material;
+
+  /// Node of the bounding volume hierarchy. Leaves hold a range of
+  /// m_bvhTriangles, inner nodes are followed by their first child and store
+  /// the index of their second child.
+  struct BVHNode {
+    Kernel::V3D minPoint;
+    Kernel::V3D maxPoint;
+    uint32_t first;
+    uint32_t count;
+    uint32_t secondChild;
+  };
+  /// Bounding volume hierarchy used to accelerate ray queries
+  std::vector<BVHNode> m_bvhNodes;
+  /// Triangle indices ordered by the bounding volume hierarchy
+  std::vector<uint32_t> m_bvhTriangles;
 };
 
 } // NAMESPACE Geometry
@@ -4,6 +4,9 @@
 //   NScD Oak Ridge National Laboratory, European Spallation Source,
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "MantidBeamline/DetectorInfo.h"
@@ -18,6 +21,16 @@
 
 namespace Mantid {
 namespace Geometry {
+
+namespace {
+void checkRange(const size_t begin, const size_t end, const size_t size) {
+  if (begin > end || end > size)
+    throw std::out_of_range("DetectorInfo: index range [" +
+                            std::to_string(begin) + ", " + std::to_string(end) +
+                            ") is invalid for " + std::to_string(size) +
+                            " detectors");
+}
+} // namespace
 /** Construct DetectorInfo based on an Instrument.
  *
  * The Instrument reference `instrument` must be the parameterized instrument
@@ -308,6 +321,52 @@ double DetectorInfo::azimuthal(const std::pair<size_t, size_t> &index) const {
   return atan2(dotVertical, dotHorizontal);
 }
 
+/** Returns L2 for the detectors with indices in [begin, end).
+ *
+ * Equivalent to calling l2() for each index, but the source and sample
+ * positions are looked up only once.
+ */
+std::vector<double> DetectorInfo::l2s(const size_t begin,
+                                      const size_t end) const {
+  checkRange(begin, end, size());
+  const auto samplePos = samplePosition();
+  const auto sourcePos = sourcePosition();
+  const double l1 = this->l1();
+  std::vector<double> result(end - begin);
+  for (size_t i = begin; i < end; ++i) {
+    const auto pos = position(i);
+    result[i - begin] = isMonitor(i) ? pos.distance(sourcePos) - l1
+                                     : pos.distance(samplePos);
+  }
+  return result;
+}
+
+/** Returns 2 theta for the detectors with indices in [begin, end).
+ *
+ * Equivalent to calling twoTheta() for each index, but the beam line is
+ * computed only once. Monitors, for which two theta is not defined, are
+ * given NaN rather than throwing.
+ */
+std::vector<double> DetectorInfo::twoThetas(const size_t begin,
+                                            const size_t end) const {
+  checkRange(begin, end, size());
+  const auto samplePos = samplePosition();
+  const auto beamLine = samplePos - sourcePosition();
+
+  if (beamLine.nullVector()) {
+    throw Kernel::Exception::InstrumentDefinitionError(
+        "Source and sample are at same position!");
+  }
+
+  std::vector<double> result(end - begin);
+  for (size_t i = begin; i < end; ++i) {
+    result[i - begin] = isMonitor(i)
+                            ? std::numeric_limits<double>::quiet_NaN()
+                            : (position(i) - samplePos).angle(beamLine);
+  }
+  return result;
+}
+
 /// Returns the position of the detector with given index.
 Kernel::V3D DetectorInfo::position(const size_t index) const {
   return Kernel::toV3D(m_detectorInfo->position(index));
@@ -461,7 +461,7 @@ void InstrumentDefinitionParser::
   while (pNode) {
     if (pNode->nodeName() == "parameter") {
       auto pParameterElem = dynamic_cast<Element *>(pNode);
-      m_hasParameterElement.emplace_back(
+      m_hasParameterElement.emplace(
           dynamic_cast<Element *>(pParameterElem->parentNode()));
     }
     pNode = it.nextNode();
@@ -2192,9 +2192,7 @@ void InstrumentDefinitionParser::setLogfile(
   // parameter, see
   // defintion of m_hasParameterElement for more info
   if (m_hasParameterElement_beenSet)
-    if (m_hasParameterElement.end() == std::find(m_hasParameterElement.begin(),
-                                                 m_hasParameterElement.end(),
-                                                 pElem))
+    if (m_hasParameterElement.count(pElem) == 0)
       return;
 
   Poco::AutoPtr<NodeList> pNL_comp =
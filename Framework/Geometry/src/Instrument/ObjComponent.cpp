@@ -120,6 +120,14 @@ int ObjComponent::interceptSurface(Track &track) const {
   const V3D trkDirection = takeOutRotation(track.direction());
 
   Track probeTrack(trkStart, trkDirection);
+  // Cheap rejection against the shape's bounding box before the full
+  // surface intersection. doesLineIntersect assumes the track starts
+  // outside the box.
+  const BoundingBox &shapeBox = shape()->getBoundingBox();
+  if (!shapeBox.isNull() && shapeBox.isAxisAligned() &&
+      !shapeBox.isPointInside(trkStart) &&
+      !shapeBox.doesLineIntersect(probeTrack))
+    return 0;
   const int intercepts = shape()->interceptSurface(probeTrack);
 
   Track::LType::const_iterator it;
@@ -326,16 +326,20 @@ void ParameterMap::clearParametersByName(const std::string &name,
   if (!m_map.empty()) {
     const ComponentID id = comp->getComponentID();
     auto itrs = m_map.equal_range(id);
+    bool erased(false);
     for (auto it = itrs.first; it != itrs.second;) {
       if (it->second->name() == name) {
         PARALLEL_CRITICAL(unsafe_erase) { it = m_map.unsafe_erase(it); }
+        erased = true;
       } else {
         ++it;
       }
     }
 
-    // Check if the caches need invalidating
-    if (name == pos() || name == rot())
+    // Check if the caches need invalidating. This is called for every
+    // component when building the Beamline objects, so only do so when
+    // something was actually removed.
+    if (erased && (name == pos() || name == rot()))
       clearPositionSensitiveCaches();
   }
 }
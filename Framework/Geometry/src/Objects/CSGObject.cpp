@@ -35,6 +35,7 @@
 #include <memory>
 
 #include <array>
+#include <cmath>
 #include <deque>
 #include <random>
 #include <stack>
@@ -375,13 +376,31 @@ double sphereSolidAngle(const V3D &observer, const std::vector<V3D> &vectors,
                         const double radius) {
   const double distance = (observer - vectors[0]).norm();
   if (distance > radius + Tolerance) {
-    const double sa = 2.0 * M_PI * (1.0 - cos(asin(radius / distance)));
-    return sa;
+    // cos(asin(x)) == sqrt(1 - x^2) for 0 <= x < 1
+    const double ratio = radius / distance;
+    return 2.0 * M_PI * (1.0 - std::sqrt(1.0 - ratio * ratio));
   } else if (distance < radius - Tolerance)
     return 4.0 * M_PI; // internal point
   else
     return 2.0 * M_PI; // surface point
 }
+
+/**
+ * Check whether the solid angle of a shape has an analytic solution
+ * @param type :: the shape type
+ * @return true if no triangulation is needed to compute the solid angle
+ */
+bool hasAnalyticSolidAngle(const detail::ShapeInfo::GeometryShape type) {
+  switch (type) {
+  case detail::ShapeInfo::GeometryShape::CUBOID:
+  case detail::ShapeInfo::GeometryShape::SPHERE:
+  case detail::ShapeInfo::GeometryShape::CYLINDER:
+  case detail::ShapeInfo::GeometryShape::CONE:
+    return true;
+  default:
+    return false;
+  }
+}
 } // namespace
 
 namespace Mantid {
@@ -424,6 +443,7 @@ CSGObject::CSGObject(const CSGObject &A) : CSGObject() { *this = A; }
 CSGObject &CSGObject::operator=(const CSGObject &A) {
   if (this != &A) {
     TopRule = (A.TopRule) ? A.TopRule->clone() : nullptr;
+    m_flatRules.clear();
     AABBxMax = A.AABBxMax;
     AABByMax = A.AABByMax;
     AABBzMax = A.AABBzMax;
@@ -816,9 +836,110 @@ int CSGObject::checkSurfaceValid(const Kernel::V3D &C,
 bool CSGObject::isValid(const Kernel::V3D &point) const {
   if (!TopRule)
     return false;
+  if (!m_flatRules.empty())
+    return isValidFlat(0, point);
   return TopRule->isValid(point);
 }
 
+/**
+ * Evaluate the flattened rule tree for a point. This gives the same answer
+ * as Rule::isValid but walks a contiguous array rather than a tree of
+ * virtual rule objects.
+ * @param index :: Index of the node at the root of the subtree to evaluate
+ * @param point :: Point to be tested
+ * @returns true if the point is within the subtree's volume
+ */
+bool CSGObject::isValidFlat(size_t index, const Kernel::V3D &point) const {
+  const FlatRule &node = m_flatRules[index];
+  switch (node.type) {
+  case FlatRule::Type::Surface:
+    return (node.surface->side(point) * node.sign) >= 0;
+  case FlatRule::Type::Object:
+    return node.object->isValid(point);
+  case FlatRule::Type::Value:
+    return node.sign > 0;
+  case FlatRule::Type::And:
+    return isValidFlat(index + 1, point) &&
+           isValidFlat(m_flatRules[index + 1].end, point);
+  case FlatRule::Type::Or:
+    return isValidFlat(index + 1, point) ||
+           isValidFlat(m_flatRules[index + 1].end, point);
+  case FlatRule::Type::Not:
+    return !isValidFlat(index + 1, point);
+  }
+  return false;
+}
+
+/**
+ * Rebuild the flattened copy of the rule tree used by isValid. If the tree
+ * contains a rule type that cannot be flattened the copy is left empty and
+ * isValid falls back to the rule tree.
+ */
+void CSGObject::flattenRules() {
+  m_flatRules.clear();
+  if (TopRule && !flattenRule(TopRule.get()))
+    m_flatRules.clear();
+}
+
+/**
+ * Append a rule and its subtree to m_flatRules in depth-first order
+ * @param rule :: Rule to append
+ * @returns true if the rule could be flattened
+ */
+bool CSGObject::flattenRule(const Rule *rule) {
+  const size_t index = m_flatRules.size();
+  m_flatRules.emplace_back(FlatRule{FlatRule::Type::Value, 0, index + 1,
+                                    nullptr, nullptr});
+  // A missing leaf is replaced by the value the rule item assumes for it
+  auto flattenLeaf = [this](const Rule *leaf, const int missing) {
+    if (leaf)
+      return flattenRule(leaf);
+    const size_t leafIndex = m_flatRules.size();
+    m_flatRules.emplace_back(FlatRule{FlatRule::Type::Value, missing,
+                                      leafIndex + 1, nullptr, nullptr});
+    return true;
+  };
+
+  bool flattened(true);
+  if (const auto *surf = dynamic_cast<const SurfPoint *>(rule)) {
+    if (surf->getKey()) {
+      m_flatRules[index].type = FlatRule::Type::Surface;
+      m_flatRules[index].sign = surf->getSign();
+      m_flatRules[index].surface = surf->getKey();
+    }
+  } else if (const auto *inter = dynamic_cast<const Intersection *>(rule)) {
+    if (inter->leaf(0) && inter->leaf(1)) {
+      m_flatRules[index].type = FlatRule::Type::And;
+      flattened = flattenRule(inter->leaf(0)) && flattenRule(inter->leaf(1));
+    }
+  } else if (dynamic_cast<const Union *>(rule)) {
+    m_flatRules[index].type = FlatRule::Type::Or;
+    flattened = flattenLeaf(rule->leaf(0), 0) && flattenLeaf(rule->leaf(1), 0);
+  } else if (const auto *comp = dynamic_cast<const CompObj *>(rule)) {
+    if (comp->getObj()) {
+      m_flatRules[index].type = FlatRule::Type::Not;
+      m_flatRules.emplace_back(FlatRule{FlatRule::Type::Object, 0, index + 2,
+                                        nullptr, comp->getObj()});
+    } else {
+      m_flatRules[index].sign = 1;
+    }
+  } else if (dynamic_cast<const CompGrp *>(rule)) {
+    if (rule->leaf(0)) {
+      m_flatRules[index].type = FlatRule::Type::Not;
+      flattened = flattenRule(rule->leaf(0));
+    } else {
+      m_flatRules[index].sign = 1;
+    }
+  } else if (dynamic_cast<const BoolValue *>(rule)) {
+    // The point is ignored by a BoolValue
+    m_flatRules[index].sign = rule->isValid(Kernel::V3D()) ? 1 : 0;
+  } else {
+    flattened = false;
+  }
+  m_flatRules[index].end = m_flatRules.size();
+  return flattened;
+}
+
 /**
  * Determines is group of surface maps are valid
  * @param SMap :: map of SurfaceNumber : status
@@ -863,6 +984,7 @@ int CSGObject::createSurfaceList(const int outFlag) {
   if (sc != m_SurList.end()) {
     m_SurList.erase(sc, m_SurList.end());
   }
+  flattenRules();
   if (outFlag) {
 
     std::vector<const Surface *>::const_iterator vc;
@@ -964,6 +1086,7 @@ void CSGObject::print() const {
 void CSGObject::makeComplement() {
   std::unique_ptr<Rule> NCG = procComp(std::move(TopRule));
   TopRule = std::move(NCG);
+  flattenRules();
 }
 
 /**
@@ -1020,6 +1143,7 @@ void CSGObject::write(std::ostream &OX) const {
  */
 int CSGObject::procString(const std::string &Line) {
   TopRule = nullptr;
+  m_flatRules.clear();
   std::map<int, std::unique_ptr<Rule>> RuleList; // List for the rules
   int Ridx = 0; // Current index (not necessary size of RuleList
   // SURFACE REPLACEMENT
@@ -1181,6 +1305,9 @@ TrackDirection CSGObject::calcValidType(const Kernel::V3D &point,
  * shape.
  */
 double CSGObject::solidAngle(const Kernel::V3D &observer) const {
+  // Avoid triangulating shapes that are handled analytically
+  if (hasAnalyticSolidAngle(this->shape()))
+    return triangulatedSolidAngle(observer);
   if (this->numberOfTriangles() > 30000)
     return rayTraceSolidAngle(observer);
   return triangulatedSolidAngle(observer);
@@ -1346,7 +1473,6 @@ double CSGObject::triangulatedSolidAngle(const V3D &observer) const {
   // Maximum of 4 vectors depending on the type
   geometry_vectors.reserve(4);
   this->GetObjectGeom(type, geometry_vectors, innerRadius, radius, height);
-  auto nTri = this->numberOfTriangles();
   // Cylinders are by far the most frequently used
   switch (type) {
   case detail::ShapeInfo::GeometryShape::CUBOID:
@@ -1364,6 +1490,8 @@ double CSGObject::triangulatedSolidAngle(const V3D &observer) const {
                           radius, height);
     break;
   default:
+    // Only the generic case needs the triangulation
+    const auto nTri = this->numberOfTriangles();
     if (nTri == 0) // Fall back to raytracing if there are no triangles
     {
       return rayTraceSolidAngle(observer);
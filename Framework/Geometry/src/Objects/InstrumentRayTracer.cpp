@@ -15,6 +15,7 @@
 #include "MantidKernel/V3D.h"
 #include <deque>
 #include <iterator>
+#include <mutex>
 #include <utility>
 
 namespace Mantid {
@@ -139,12 +140,18 @@ void InstrumentRayTracer::fireRay(Track &testRay) const {
     node = nodeQueue.front();
     nodeQueue.pop_front();
     BoundingBox bbox;
-    auto it = m_boxCache.find(node->getComponentID());
-    if (it != m_boxCache.end()) {
-      bbox = it->second;
-    } else {
+    bool cached(false);
+    {
+      std::shared_lock<std::shared_mutex> lock(m_mutex);
+      auto it = m_boxCache.find(node->getComponentID());
+      if (it != m_boxCache.end()) {
+        bbox = it->second;
+        cached = true;
+      }
+    }
+    if (!cached) {
       node->getBoundingBox(bbox);
-      std::lock_guard<std::mutex> lock(m_mutex);
+      std::unique_lock<std::shared_mutex> lock(m_mutex);
       m_boxCache[node->getComponentID()] = bbox;
     }
 
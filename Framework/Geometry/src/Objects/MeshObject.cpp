@@ -14,11 +14,51 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Material.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <numeric>
 
 namespace Mantid {
 namespace Geometry {
 
+namespace {
+/// Largest number of triangles held in a leaf of the bounding volume hierarchy
+constexpr uint32_t MAX_LEAF_TRIANGLES = 4;
+/// Marks a node that is not the second child of another node
+constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+/**
+ * Check whether a ray passes through an axis aligned box
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @param minPoint :: Minimum corner of the box
+ * @param maxPoint :: Maximum corner of the box
+ * @returns true if the ray hits the box
+ */
+bool rayHitsBox(const Kernel::V3D &start, const Kernel::V3D &direction,
+                const Kernel::V3D &minPoint, const Kernel::V3D &maxPoint) {
+  double tMin = 0.0;
+  double tMax = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < 3; ++i) {
+    if (direction[i] == 0.0) {
+      if (start[i] < minPoint[i] || start[i] > maxPoint[i])
+        return false;
+    } else {
+      double t1 = (minPoint[i] - start[i]) / direction[i];
+      double t2 = (maxPoint[i] - start[i]) / direction[i];
+      if (t1 > t2)
+        std::swap(t1, t2);
+      tMin = std::max(tMin, t1);
+      tMax = std::min(tMax, t2);
+      if (tMin > tMax)
+        return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
 MeshObject::MeshObject(const std::vector<uint32_t> &faces,
                        const std::vector<Kernel::V3D> &vertices,
                        const Kernel::Material &material)
@@ -42,6 +82,120 @@ void MeshObject::initialize() {
 
   MeshObjectCommon::checkVertexLimit(m_vertices.size());
   m_handler = std::make_shared<GeometryHandler>(*this);
+  buildBVH();
+}
+
+/**
+ * Build a bounding volume hierarchy over the triangles by recursively
+ * splitting them at the median centroid along the longest axis. The nodes
+ * are stored depth first so the first child of a node directly follows it.
+ */
+void MeshObject::buildBVH() {
+  m_bvhNodes.clear();
+  const auto nTriangles = static_cast<uint32_t>(numberOfTriangles());
+  m_bvhTriangles.resize(nTriangles);
+  std::iota(m_bvhTriangles.begin(), m_bvhTriangles.end(), 0);
+  if (nTriangles == 0)
+    return;
+
+  std::vector<Kernel::V3D> centroids(nTriangles);
+  Kernel::V3D vertex1, vertex2, vertex3;
+  for (uint32_t i = 0; i < nTriangles; ++i) {
+    getTriangle(i, vertex1, vertex2, vertex3);
+    centroids[i] = (vertex1 + vertex2 + vertex3) / 3.0;
+  }
+
+  struct Task {
+    uint32_t first;
+    uint32_t count;
+    uint32_t parent;
+  };
+  std::vector<Task> tasks{{0, nTriangles, NO_PARENT}};
+  const auto lowest = std::numeric_limits<double>::lowest();
+  const auto highest = std::numeric_limits<double>::max();
+  while (!tasks.empty()) {
+    const Task task = tasks.back();
+    tasks.pop_back();
+    const auto nodeIndex = static_cast<uint32_t>(m_bvhNodes.size());
+    if (task.parent != NO_PARENT)
+      m_bvhNodes[task.parent].secondChild = nodeIndex;
+
+    const auto begin = m_bvhTriangles.begin() + task.first;
+    const auto end = begin + task.count;
+    Kernel::V3D minPoint(highest, highest, highest);
+    Kernel::V3D maxPoint(lowest, lowest, lowest);
+    Kernel::V3D minCentroid(minPoint), maxCentroid(maxPoint);
+    for (auto triangle = begin; triangle != end; ++triangle) {
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const auto &vertex = m_vertices[m_triangles[3 * (*triangle) + corner]];
+        for (size_t i = 0; i < 3; ++i) {
+          minPoint[i] = std::min(minPoint[i], vertex[i]);
+          maxPoint[i] = std::max(maxPoint[i], vertex[i]);
+        }
+      }
+      const auto &centroid = centroids[*triangle];
+      for (size_t i = 0; i < 3; ++i) {
+        minCentroid[i] = std::min(minCentroid[i], centroid[i]);
+        maxCentroid[i] = std::max(maxCentroid[i], centroid[i]);
+      }
+    }
+    // Pad the box so rounding in the triangle test cannot miss a hit
+    const double padding =
+        M_TOLERANCE + M_TOLERANCE * maxPoint.distance(minPoint);
+    const Kernel::V3D pad(padding, padding, padding);
+    m_bvhNodes.emplace_back(
+        BVHNode{minPoint - pad, maxPoint + pad, task.first, task.count, 0});
+
+    const auto extent = maxCentroid - minCentroid;
+    size_t axis = 0;
+    if (extent[1] > extent[axis])
+      axis = 1;
+    if (extent[2] > extent[axis])
+      axis = 2;
+    if (task.count <= MAX_LEAF_TRIANGLES || extent[axis] <= 0.0)
+      continue;
+
+    // Split into an inner node with two children
+    m_bvhNodes.back().count = 0;
+    const uint32_t half = task.count / 2;
+    std::nth_element(begin, begin + half, end,
+                     [&centroids, axis](const uint32_t a, const uint32_t b) {
+                       return centroids[a][axis] < centroids[b][axis];
+                     });
+    tasks.push_back({task.first + half, task.count - half, nodeIndex});
+    tasks.push_back({task.first, half, NO_PARENT});
+  }
+}
+
+/**
+ * Get the triangles whose bounding volumes are hit by a ray
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @param candidates :: Indices of the triangles in ascending order
+ */
+void MeshObject::getCandidateTriangles(
+    const Kernel::V3D &start, const Kernel::V3D &direction,
+    std::vector<uint32_t> &candidates) const {
+  candidates.clear();
+  if (m_bvhNodes.empty())
+    return;
+  std::vector<uint32_t> stack{0};
+  while (!stack.empty()) {
+    const auto nodeIndex = stack.back();
+    stack.pop_back();
+    const auto &node = m_bvhNodes[nodeIndex];
+    if (!rayHitsBox(start, direction, node.minPoint, node.maxPoint))
+      continue;
+    if (node.count > 0) {
+      const auto first = m_bvhTriangles.cbegin() + node.first;
+      candidates.insert(candidates.end(), first, first + node.count);
+    } else {
+      stack.emplace_back(node.secondChild);
+      stack.emplace_back(nodeIndex + 1);
+    }
+  }
+  // Preserve the order of a search over all triangles
+  std::sort(candidates.begin(), candidates.end());
 }
 
 /**
@@ -182,7 +336,10 @@ int MeshObject::interceptSurface(Geometry::Track &UT) const {
 double MeshObject::distance(const Track &track) const {
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection unused;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  std::vector<uint32_t> candidates;
+  getCandidateTriangles(track.startPoint(), track.direction(), candidates);
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(
             track.startPoint(), track.direction(), vertex1, vertex2, vertex3,
             intersection, unused)) {
@@ -209,7 +366,10 @@ void MeshObject::getIntersections(
 
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  std::vector<uint32_t> candidates;
+  getCandidateTriangles(start, direction, candidates);
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1,
                                                 vertex2, vertex3, intersection,
                                                 entryExit)) {
@@ -499,6 +659,7 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex.rotate(rotationMatrix);
   }
+  buildBVH();
 }
 
 /**
@@ -509,6 +670,7 @@ void MeshObject::translate(const Kernel::V3D &translationVector) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex += translationVector;
   }
+  buildBVH();
 }
 
 /**
@@ -519,6 +681,7 @@ void MeshObject::scale(const double scaleFactor) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex *= scaleFactor;
   }
+  buildBVH();
 }
 
 /**
@@ -544,6 +707,7 @@ void MeshObject::multiply(const Kernel::Matrix<double> &matrix) {
     Kernel::V3D newvertex(vertexout[0], vertexout[1], vertexout[2]);
     vertex = newvertex;
   }
+  buildBVH();
 }
 
 /**
@@ -196,6 +196,23 @@ public:
     TS_ASSERT_EQUALS(geom_obj->isValid(V3D(-3.3, 0, 0)), false);
   }
 
+  void testIsValidMatchesRuleTree() {
+    auto geom_obj = createCappedCylinder();
+    const Rule *rule = geom_obj->topRule();
+    for (double x = -4.0; x <= 4.0; x += 0.5) {
+      for (double y = -4.0; y <= 4.0; y += 0.5) {
+        for (double z = -4.0; z <= 4.0; z += 0.5) {
+          const V3D pt(x, y, z);
+          TS_ASSERT_EQUALS(geom_obj->isValid(pt), rule->isValid(pt));
+        }
+      }
+    }
+    // The complement must be picked up by the flattened rules
+    geom_obj->makeComplement();
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(0, 0, 0)), false);
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(0, 3.1, 0)), true);
+  }
+
   void testIsOnSideSphere() {
     auto geom_obj = ComponentCreationHelper::createSphere(4.1);
     // inside
@@ -993,6 +1010,28 @@ public:
                     2 * M_PI, satol);
   }
 
+  void testSolidAngleSphereMatchesClosedForm() {
+    // A sphere of radius r seen from a distance d subtends a cone of half
+    // angle asin(r / d), i.e. 2 pi (1 - sqrt(1 - r^2 / d^2)) steradians. The
+    // tolerance is far tighter than the ~1% of the ray tracing estimate, so
+    // this only passes if the analytic path is taken.
+    const double radius = 0.5;
+    auto geom_obj =
+        ComponentCreationHelper::createSphere(radius, V3D(1.0, -2.0, 3.0));
+    TS_ASSERT_EQUALS(geom_obj->shape(), ShapeInfo::GeometryShape::SPHERE);
+
+    const std::vector<double> distances{0.6, 1.0, 2.5, 10.0};
+    for (const double distance : distances) {
+      const V3D observer(1.0, -2.0, 3.0 + distance);
+      const double ratio = radius / distance;
+      const double expected =
+          2.0 * M_PI * (1.0 - std::sqrt(1.0 - ratio * ratio));
+      TS_ASSERT_DELTA(geom_obj->solidAngle(observer), expected, 1e-12);
+    }
+    TS_ASSERT_DELTA(geom_obj->solidAngle(V3D(1.0, -2.0, 3.2)), 4.0 * M_PI,
+                    1e-12);
+  }
+
   void testSolidAngleCubeTriangles()
   /**
   Test solid angle calculation for a cube using triangles
@@ -984,6 +984,18 @@ public:
     auto moved = octahedron->getVertices();
     TS_ASSERT_DELTA(moved, checkVector, 1e-8);
   }
+
+  void testInterceptAfterTranslate() {
+    std::vector<Link> expectedResults;
+    auto geom_obj = createOctahedron();
+    geom_obj->translate(V3D(1, 2, 3));
+    Track track(V3D(-10, 2.2, 3.2), V3D(1, 0, 0));
+
+    // format = startPoint, endPoint, total distance so far
+    expectedResults.emplace_back(
+        Link(V3D(0.4, 2.2, 3.2), V3D(1.6, 2.2, 3.2), 11.6, *geom_obj));
+    checkTrackIntercept(std::move(geom_obj), track, expectedResults);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -183,6 +183,18 @@ public:
                      const Exception::NullPointerException &);
   }
 
+  void testInterceptSurfaceTrackStartingInsideShape() {
+    ObjComponent ocyl("ocyl", createCappedCylinder());
+    ocyl.setPos(10, 0, 0);
+    ocyl.setRot(Quat(90.0, V3D(0, 0, 1)));
+    // Starts inside the bounding box so must not be rejected by it
+    Track track(V3D(10, 0, 0), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(ocyl.interceptSurface(track), 1);
+    // Passes well clear of the bounding box
+    Track miss(V3D(0, 0, 0), V3D(0, 0, 1));
+    TS_ASSERT_EQUALS(ocyl.interceptSurface(miss), 0);
+  }
+
   void testSolidAngleCappedCylinder() {
     ObjComponent A("ocyl", createCappedCylinder());
     A.setPos(10, 0, 0);
@@ -487,6 +487,22 @@ public:
                       Parameter_sptr());
   }
 
+  void testClearByName_For_Cmpt_Keeps_Caches_When_Nothing_Removed() {
+    ParameterMap pmap;
+    pmap.addDouble(m_testInstrument.get(), "first", 5.4);
+    IComponent_sptr comp = m_testInstrument->getChild(0);
+    pmap.setCachedLocation(comp.get(), V3D(1, 2, 3));
+    pmap.clearParametersByName(ParameterMap::pos(), comp.get());
+    V3D cached;
+    TS_ASSERT(pmap.getCachedLocation(comp.get(), cached));
+    TS_ASSERT_EQUALS(cached, V3D(1, 2, 3));
+
+    pmap.addV3D(comp.get(), ParameterMap::pos(), V3D(4, 5, 6));
+    pmap.setCachedLocation(comp.get(), V3D(1, 2, 3));
+    pmap.clearParametersByName(ParameterMap::pos(), comp.get());
+    TS_ASSERT(!pmap.getCachedLocation(comp.get(), cached));
+  }
+
   void testClearByName_Only_Removes_Named_Parameter_for_Cmpt() {
     ParameterMap pmap;
     pmap.addDouble(m_testInstrument.get(), "first", 5.4);
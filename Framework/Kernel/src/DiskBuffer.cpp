@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/DiskBuffer.h"
 #include "MantidKernel/ISaveable.h"
+#include <algorithm>
 #include <sstream>
 #include <utility>
 
@@ -116,6 +117,17 @@ void DiskBuffer::writeOldObjects() {
   size_t objectsNotWritten(0);
   size_t memoryNotWritten(0);
 
+  // Objects to write, with the file position and size allocated to them.
+  // They are written out once every position is known, sorted by position,
+  // so that the file is updated in a single forward sweep rather than by
+  // random seeks.
+  struct PendingWrite {
+    ISaveable *object;
+    uint64_t position;
+    uint64_t size;
+  };
+  std::vector<PendingWrite> writes;
+
   // Iterate through the list
   auto it = m_toWriteBuffer.begin();
   auto it_end = m_toWriteBuffer.end();
@@ -126,41 +138,35 @@ void DiskBuffer::writeOldObjects() {
     obj = *it;
     if (!obj->isBusy()) {
       uint64_t NumObjEvents = obj->getTotalDataSize();
-      uint64_t fileIndexStart;
       if (!obj->wasSaved()) {
-        fileIndexStart = this->allocate(NumObjEvents);
-        // Write to the disk; this will call the object specific save function;
-        // Prevent simultaneous file access (e.g. write while loading)
-        obj->saveAt(fileIndexStart, NumObjEvents);
+        writes.push_back({obj, this->allocate(NumObjEvents), NumObjEvents});
       } else {
         uint64_t NumFileEvents = obj->getFileSize();
         if (NumObjEvents != NumFileEvents) {
           // Event list changed size. The MRU can tell us where it best fits
-          // now.
-          fileIndexStart = this->relocate(obj->getFilePosition(), NumFileEvents,
-                                          NumObjEvents);
-          // Write to the disk; this will call the object specific save
-          // function;
-          obj->saveAt(fileIndexStart, NumObjEvents);
+          // now. The old block is freed and may be written over by another
+          // object before this one is saved, so read its contents first.
+          {
+            std::lock_guard<std::mutex> objLock(obj->m_setter);
+            obj->load();
+          }
+          writes.push_back({obj,
+                            this->relocate(obj->getFilePosition(),
+                                           NumFileEvents, NumObjEvents),
+                            NumObjEvents});
         } else // despite object size have not been changed, it can be modified
                // other way. In this case, the method which changed the data
                // should set dataChanged ID
         {
           if (obj->isDataChanged()) {
-            fileIndexStart = obj->getFilePosition();
-            // Write to the disk; this will call the object specific save
-            // function;
-            obj->saveAt(fileIndexStart, NumObjEvents);
-            // this is questionable operation, which adjust file size in case
-            // when the file postions were allocated externaly
-            if (fileIndexStart + NumObjEvents > m_fileLength)
-              m_fileLength = fileIndexStart + NumObjEvents;
-          } else // just clean the object up -- it just occupies memory
+            writes.push_back({obj, obj->getFilePosition(), NumObjEvents});
+          } else { // just clean the object up -- it just occupies memory
             obj->clearDataFromMemory();
+            // tell the object that it has been removed from the buffer
+            obj->clearBufferState();
+          }
         }
       }
-      // tell the object that it has been removed from the buffer
-      obj->clearBufferState();
     } else // object busy
     {
       // The object is busy, can't write. Save it for later
@@ -174,6 +180,21 @@ void DiskBuffer::writeOldObjects() {
     }
   }
 
+  std::sort(writes.begin(), writes.end(),
+            [](const PendingWrite &a, const PendingWrite &b) {
+              return a.position < b.position;
+            });
+  for (const auto &write : writes) {
+    // Write to the disk; this will call the object specific save function;
+    write.object->saveAt(write.position, write.size);
+    // this is questionable operation, which adjust file size in case
+    // when the file postions were allocated externaly
+    if (write.position + write.size > m_fileLength)
+      m_fileLength = write.position + write.size;
+    // tell the object that it has been removed from the buffer
+    write.object->clearBufferState();
+  }
+
   // use last object to clear NeXus buffer and actually write data to HDD
   if (obj) {
     // NXS needs to flush the writes to file by closing and re-opening the data
@@ -78,6 +78,7 @@ public:
 
     for (size_t i = mPos; i < mPos + mMem; i++)
       fakeFile[i] = m_ch;
+    writeOrder.push_back(m_ch);
 
     streamMutex.unlock();
     // this is important function call which has to be implemented by any save
@@ -96,11 +97,13 @@ public:
   void flushData() const override {}
 
   static std::string fakeFile;
+  static std::string writeOrder;
   static std::mutex streamMutex;
 };
 
 // Declare the static members here.
 std::string SaveableTesterWithFile::fakeFile;
+std::string SaveableTesterWithFile::writeOrder;
 std::mutex SaveableTesterWithFile::streamMutex;
 
 //====================================================================================
@@ -113,6 +116,7 @@ public:
     // Create the ISaveables
     num = 10;
     SaveableTesterWithFile::fakeFile = "";
+    SaveableTesterWithFile::writeOrder = "";
     data.clear();
     for (size_t i = 0; i < num; i++)
       data.emplace_back(
@@ -188,6 +192,8 @@ public:
 
     // 0 1 2 3 4 5 6 7 8 9
     TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "  BB      FF      JJ");
+    // and were written in order of file position, not of arrival
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::writeOrder, "BFJ");
     // These 4 at the end will be in the cache
     dbuf.toWrite(data[2]);
     dbuf.toWrite(data[3]);
@@ -200,6 +206,33 @@ public:
     // The "file" was written out this way (sorted by file position):
     // 0 1 2 3 4 5 6 7 8 9
     TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "  BBCCDDEEFF      JJ");
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::writeOrder, "BFJCDE");
+  }
+
+  /** New and relocated objects are written in order of the file position
+   * allocated to them, together with the objects rewritten in place */
+  void test_allocatedWritesAreInFileOrder() {
+    SaveableTesterWithFile newX(0, 3, 'X', false);
+    SaveableTesterWithFile newY(0, 2, 'Y', false);
+    DiskBuffer dbuf(100);
+    dbuf.setFileLength(20);
+    // A grows and has to move, E is changed in place
+    data[0]->AddNewObjects(2);
+    data[4]->setDataChanged();
+
+    dbuf.toWrite(&newY);
+    dbuf.toWrite(data[4]);
+    dbuf.toWrite(data[0]);
+    dbuf.toWrite(&newX);
+    dbuf.flushCache();
+
+    // X goes to the end of the file, A after it, and Y into the block A left
+    TS_ASSERT_EQUALS(newY.getFilePosition(), 0);
+    TS_ASSERT_EQUALS(newX.getFilePosition(), 20);
+    TS_ASSERT_EQUALS(data[0]->getFilePosition(), 23);
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::writeOrder, "YEXA");
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile,
+                     "YY      EE          XXXAAAA");
   }
 
   //--------------------------------------------------------------------------------
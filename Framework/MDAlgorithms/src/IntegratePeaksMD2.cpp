@@ -51,6 +51,45 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 
+namespace {
+/** Find the deepest box of the workspace tree that contains the whole cube
+ * of half-width radius around a centre.
+ *
+ * The integration routines test every vertex of the grid box they are called
+ * on, so starting from the smallest enclosing box rather than the root avoids
+ * rescanning the whole top-level grid for every peak. Spheres and the
+ * ellipsoids derived from them (whose transform only stretches distances)
+ * both lie inside this cube.
+ *
+ * @param root :: the top-level box of the workspace
+ * @param center :: centre of the integration region
+ * @param radius :: largest distance from the centre that is integrated
+ * @return the deepest enclosing box, or the root if none is deeper
+ */
+template <typename MDE, size_t nd>
+MDBoxBase<MDE, nd> *findEnclosingBox(MDBoxBase<MDE, nd> *root,
+                                     const coord_t *center,
+                                     const coord_t radius) {
+  // getBoxAtCoord() only reads the tree, the node itself is not const
+  auto *node = const_cast<API::IMDNode *>(root->getBoxAtCoord(center));
+  while (node && node != root) {
+    bool contains = true;
+    for (size_t d = 0; d < nd; d++) {
+      const auto &extents = node->getExtents(d);
+      if (center[d] - radius < extents.getMin() ||
+          center[d] + radius >= extents.getMax()) {
+        contains = false;
+        break;
+      }
+    }
+    if (contains)
+      return dynamic_cast<MDBoxBase<MDE, nd> *>(node);
+    node = node->getParent();
+  }
+  return root;
+}
+} // namespace
+
 /** Initialize the algorithm's properties.
  */
 void IntegratePeaksMD2::init() {
@@ -383,6 +422,11 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
           adaptiveQBackgroundMultiplier * lenQpeak + BackgroundOuterRadius;
       // define the radius squared for a sphere intially
       CoordTransformDistance getRadiusSq(nd, center, dimensionsUsed);
+      // all the integrations for this peak happen inside this box
+      MDBoxBase<MDE, nd> *integrationBox = findEnclosingBox(
+          ws->getBox(), center,
+          static_cast<coord_t>(std::max(PeakRadiusVector[i],
+                                        BackgroundOuterRadiusVector[i])));
       // set spherical shape
       if (auto *shapeablePeak = dynamic_cast<Peak *>(&p)) {
         PeakShape *sphereShape = new PeakShapeSpherical(
@@ -397,7 +441,7 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       // Integrate spherical background shell if specified
       if (BackgroundOuterRadius > PeakRadius) {
         // Get the total signal inside background shell
-        ws->getBox()->integrateSphere(
+        integrationBox->integrateSphere(
             getRadiusSq,
             static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)),
             bgSignal, bgErrorSquared,
@@ -429,7 +473,7 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
           // Get the total signal inside "BackgroundOuterRadius"
           bgSignal = 0;
           bgErrorSquared = 0;
-          ws->getBox()->integrateSphere(
+          integrationBox->integrateSphere(
               getRadiusSq,
               static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)),
               bgSignal, bgErrorSquared,
@@ -461,7 +505,7 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         }
       }
       // spherical integration of signal
-      ws->getBox()->integrateSphere(
+      integrationBox->integrateSphere(
           getRadiusSq, static_cast<coord_t>(adaptiveRadius * adaptiveRadius),
           signal, errorSquared, 0.0 /* innerRadiusSquared */,
           useOnePercentBackgroundCorrection);
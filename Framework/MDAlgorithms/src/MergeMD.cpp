@@ -199,6 +199,44 @@ inline void copyEvent(const MDEvent<nd> &srcEvent, MDEvent<ond> &newEvent,
       static_cast<uint16_t>(srcEvent.getRunIndex() + runIndexOffset));
 }
 
+//----------------------------------------------------------------------------------------------
+/** Find the deepest box of the target tree which fully contains the extents
+ * of a box of another tree.
+ *
+ * When the input workspaces share the box structure of the output (the common
+ * case of merging runs converted with identical BoxController settings) this
+ * returns the matching leaf box, so that the whole event block can be
+ * appended in one go rather than routing every event down from the root.
+ *
+ * @param root :: the top-level box of the target workspace
+ * @param srcBox :: the box whose extents should be contained
+ * @return the deepest containing box, or the root if nothing deeper matches
+ */
+template <typename MDE, size_t nd>
+MDBoxBase<MDE, nd> *findContainingBox(MDBoxBase<MDE, nd> *root,
+                                      API::IMDNode *srcBox) {
+  coord_t center[nd];
+  srcBox->getCenter(center);
+  // getBoxAtCoord() only reads the tree, the node itself is not const
+  auto *node = const_cast<API::IMDNode *>(root->getBoxAtCoord(center));
+  while (node && node != root) {
+    bool contains = true;
+    for (size_t d = 0; d < nd; d++) {
+      const auto &target = node->getExtents(d);
+      const auto &source = srcBox->getExtents(d);
+      if (source.getMin() < target.getMin() ||
+          source.getMax() > target.getMax()) {
+        contains = false;
+        break;
+      }
+    }
+    if (contains)
+      return dynamic_cast<MDBoxBase<MDE, nd> *>(node);
+    node = node->getParent();
+  }
+  return root;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the adding.
  * Will do out += ws
@@ -240,17 +278,25 @@ void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
       PARALLEL_START_INTERUPT_REGION
       auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
       if (box && !box->getIsMasked()) {
-        // Copy the events from WS2 and add them into WS1
+        // Copy the events from WS2
         const std::vector<MDE> &events = box->getConstEvents();
-        // Add events, with bounds checking
-
+        std::vector<MDE> newEvents;
+        newEvents.reserve(events.size());
         for (auto it = events.cbegin(); it != events.cend(); ++it) {
           // Create the event
-          MDE newEvent(it->getSignal(), it->getErrorSquared(), it->getCenter());
+          newEvents.emplace_back(it->getSignal(), it->getErrorSquared(),
+                                 it->getCenter());
           // Copy extra data, if any
-          copyEvent(*it, newEvent, runIndexOffset);
-          // Add it to the workspace
-          box1->addEvent(newEvent);
+          copyEvent(*it, newEvents.back(), runIndexOffset);
+        }
+        // Add them into WS1 starting from the deepest box covering the source
+        // box. A matching leaf takes the whole block under a single lock.
+        MDBoxBase<MDE, nd> *target = findContainingBox(box1, box);
+        if (target->isBox()) {
+          target->addEvents(newEvents);
+        } else {
+          for (const auto &newEvent : newEvents)
+            target->addEvent(newEvent);
         }
         if (fileBasedSource)
           box->clear();
@@ -82,6 +82,15 @@ void SaveMD::init() {
   setPropertySettings("MakeFileBacked",
                       std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
                                                             IS_EQUAL_TO, "0"));
+
+  declareProperty("CompressEvents", false,
+                  "Only for MDEventWorkspaces: compress the event data in the "
+                  "file.\n"
+                  "Produces much smaller files at the cost of slower writing. "
+                  "Has no effect when updating an existing file back end.");
+  setPropertySettings("CompressEvents",
+                      std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
+                                                            IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -165,8 +174,10 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     // the boxes file positions are unknown and we need to calculate it.
     BoxFlatStruct.initFlatStructure(ws, filename);
     // create saver class
-    auto Saver = std::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+    auto nexusSaver =
+        std::make_shared<DataObjects::BoxControllerNeXusIO>(bc.get());
+    nexusSaver->setCompression(getProperty("CompressEvents"));
+    std::shared_ptr<API::IBoxControllerIO> Saver = nexusSaver;
     Saver->setDataType(sizeof(coord_t), MDE::getTypeName());
     if (makeFileBackend) {
       // store saver with box controller
@@ -103,6 +103,38 @@ public:
     AnalysisDataService::Instance().remove(outWSName);
   }
 
+  void test_exec_identical_box_structure() {
+    std::string outWSName("MergeMDTest_OutputWS");
+    makeAnyMDEW<MDLeanEvent<2>, 2>(10, 0., 10., 3, "same0");
+    makeAnyMDEW<MDLeanEvent<2>, 2>(10, 0., 10., 3, "same1");
+
+    MergeMD alg;
+    alg.setChild(true);
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("InputWorkspaces", "same0,same1"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("SplitInto", "10"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("SplitThreshold", "1000"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "_"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute(););
+    TS_ASSERT(alg.isExecuted());
+    IMDEventWorkspace_sptr ws = alg.getProperty("OutputWorkspace");
+    TS_ASSERT(ws);
+
+    // Every leaf of the output matches a leaf of the inputs
+    TS_ASSERT_EQUALS(ws->getNPoints(), 2 * 3 * 10 * 10);
+    std::vector<API::IMDNode *> boxes;
+    ws->getBox()->getBoxes(boxes, 10, true);
+    TS_ASSERT_EQUALS(boxes.size(), 10 * 10);
+    for (auto box : boxes) {
+      TS_ASSERT_EQUALS(box->getNPoints(), 6);
+      TS_ASSERT_DELTA(box->getSignal(), 6.0, 1e-5);
+    }
+
+    AnalysisDataService::Instance().remove("same0");
+    AnalysisDataService::Instance().remove("same1");
+  }
+
   void test_masked_data_omitted() {
     // Name of the output workspace.
     std::string outWSName("MergeMDTest_OutputWS");